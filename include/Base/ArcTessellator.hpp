@@ -0,0 +1,95 @@
+/**
+ * @file ArcTessellator.hpp
+ * @brief Defines the ArcTessellator used to build rounded corner geometry.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for ArcTessellator, the shared
+ * kernel that turns quarter-circle arcs into points from precomputed
+ * unit-circle tables instead of evaluating trigonometry per segment.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include <array>
+
+
+namespace SFUI {
+
+    /**
+     * @brief Quarter-circle arc tessellation kernel.
+     *
+     * Arcs get the fewest segments that keep them within a screen-space error
+     * tolerance of the true circle, given a level of detail combining the scale
+     * the UI is viewed at and its quality factor. The kernel holds no state, so
+     * each UI passes its own level of detail. Resolutions are bounded, so the
+     * unit-circle points of every resolution are tabulated once.
+     */
+    class ArcTessellator {
+
+        public:
+            /**
+             * @brief Fewest segments of a quarter circle.
+             */
+            static constexpr SFUI::Int minResolution = 1;
+
+            /**
+             * @brief Most segments of a quarter circle.
+             */
+            static constexpr SFUI::Int maxResolution = 24;
+
+            /**
+             * @brief Most points of a tessellated quarter circle.
+             */
+            static constexpr SFUI::Int maxPointCount = maxResolution + 1;
+
+            /**
+             * @brief Largest distance in screen pixels between a tessellated arc and the true circle, at quality 1.
+             */
+            static constexpr SFUI::Float TOLERANCE = 0.25f;
+
+        public:
+            /**
+             * @brief Get the number of segments used for a quarter circle of a radius.
+             *
+             * @param radius Radius of the arc.
+             * @param detail Level of detail, the product of the view scale and the quality factor.
+             *
+             * @return Segment count between minResolution and maxResolution.
+             */
+            static SFUI::Int getResolution(SFUI::Float radius, SFUI::Float detail);
+
+            /**
+             * @brief Compute the points of a quarter-circle arc.
+             *
+             * @param center Center of the arc.
+             * @param radius Radius of the arc.
+             * @param startAngleDeg Starting angle in degrees, a multiple of 90; the arc ends 90 degrees later.
+             * @param resolution Segment count of the arc, from getResolution().
+             * @param pointsX Output x coordinates, resolution + 1 of them.
+             * @param pointsY Output y coordinates, resolution + 1 of them.
+             */
+            static SFUI::Void tessellate(SFUI::Vector2f center, SFUI::Float radius, SFUI::Float startAngleDeg, SFUI::Int resolution, SFUI::Float* pointsX, SFUI::Float* pointsY);
+
+        private:
+            /**
+             * @brief Unit-circle points of a quarter circle from 0 to 90 degrees.
+             */
+            struct QuarterCircle {
+                std::array<SFUI::Float, maxPointCount> cosines;
+                std::array<SFUI::Float, maxPointCount> sines;
+            };
+
+        private:
+            /**
+             * @brief Get the quarter-circle table of every resolution, built on first use.
+             *
+             * @return Tables indexed by resolution.
+             */
+            static const std::array<SFUI::ArcTessellator::QuarterCircle, maxPointCount>& getQuarterCircles();
+    };
+}
@@ -0,0 +1,114 @@
+/**
+ * @file ClipStack.hpp
+ * @brief Defines the ClipStack class used to clip the UI tree.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for ClipStack, a CPU-side
+ * stack of nested clip rectangles that is applied through the scissor
+ * of the render target's view, so OpenGL never has to be queried.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Stack of nested clip rectangles.
+     *
+     * Each pushed rectangle is intersected with the one below it, so the top
+     * of the stack is always the effective clip. Clips are applied as the
+     * scissor of the render target's view, so SFML owns the scissor state and
+     * enables it again whenever it applies the view, and a clip is only set
+     * when it changes the scissor of the view.
+     */
+    class ClipStack {
+
+        public:
+            /**
+             * @brief Construct an empty clip stack.
+             */
+            ClipStack();
+
+            /**
+             * @brief Empty the stack.
+             */
+            SFUI::Void reset();
+
+            /**
+             * @brief Push a clip rectangle, intersected with the current clip.
+             *
+             * @param clipRect Clip rectangle in render target coordinates.
+             */
+            SFUI::Void push(const SFUI::FloatRect& clipRect);
+
+            /**
+             * @brief Restore the clip that was active before the last push().
+             */
+            SFUI::Void pop();
+
+            /**
+             * @brief Get the effective clip rectangle.
+             *
+             * @return The top of the stack, or an empty optional if unclipped.
+             */
+            SFUI::Optional<SFUI::FloatRect> getClip() const;
+
+            /**
+             * @brief Set the scissor of a render target's view to a clip rectangle if it is not already set.
+             *
+             * @param drawTarget Render target whose view is clipped.
+             * @param clipRect Clip rectangle in the coordinates of the view, or an empty optional to disable clipping.
+             */
+            static SFUI::Void apply(SFUI::RenderTarget& drawTarget, const SFUI::Optional<SFUI::FloatRect>& clipRect);
+
+            /**
+             * @brief Narrow the scissor of a render target's view to a clip rectangle, within the scissor already set.
+             *
+             * @param drawTarget Render target whose view is clipped.
+             * @param clipRect Clip rectangle in the coordinates of the view.
+             *
+             * @return Scissor of the view before it was narrowed, to give back to restore().
+             */
+            static SFUI::FloatRect intersect(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& clipRect);
+
+            /**
+             * @brief Set the scissor of a render target's view back to the one it had before intersect().
+             *
+             * @param drawTarget Render target whose view is clipped.
+             * @param scissor Scissor returned by intersect().
+             */
+            static SFUI::Void restore(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& scissor);
+
+        private:
+            /**
+             * @brief Intersected clip rectangles, the top one being effective.
+             */
+            SFUI::Vector<SFUI::FloatRect> clipRects;
+
+        private:
+            /**
+             * @brief Convert a clip rectangle to a view scissor.
+             *
+             * @param view View the clip rectangle is given in.
+             * @param clipRect Clip rectangle in the coordinates of the view.
+             *
+             * @return Scissor as a ratio of the render target, within the unit rectangle.
+             */
+            static SFUI::FloatRect toScissor(const SFUI::View& view, const SFUI::FloatRect& clipRect);
+
+            /**
+             * @brief Set the scissor of a render target's view if it is not already set.
+             *
+             * @param drawTarget Render target whose view is clipped.
+             * @param scissor Scissor as a ratio of the render target.
+             */
+            static SFUI::Void setScissor(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& scissor);
+    };
+}
@@ -12,6 +12,9 @@
 
 #pragma once
 #include "Base/Animation.hpp"
+#include "Base/RenderBatch.hpp"
+#include "Base/Mesh.hpp"
+#include "Base/MeshRegistry.hpp"
 #include "Types/base.hpp"
 #include "Types/render.hpp"
 #include "Types/vector.hpp"
@@ -19,6 +22,7 @@
 #include "Types/propgroup.hpp"
 #include "Types/propset.hpp"
 #include "Types/computedprop.hpp"
+#include "Types/compiledprop.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -38,6 +42,17 @@ namespace SFUI {
         protected:
             struct ComputedChildLayout;
 
+        public:
+            /**
+             * @brief Event types a component consumes, used by the UIRoot to route events.
+             */
+            struct EventSubscriptions {
+                SFUI::Bool mouse = true;
+                SFUI::Bool keyboard = true;
+                SFUI::Bool text = true;
+                SFUI::Bool other = true;
+            };
+
         public:
             /**
              * @brief Unique identifier for this component.
@@ -99,6 +114,25 @@ namespace SFUI {
              */
             virtual SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) = 0;
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * Appends the same geometry as draw(), in the same order, so that it can be merged with the
+             * geometry of other components. Components drawing text, sprites or inner components override it.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            virtual SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch);
+
+            /**
+             * @brief Draw the overlay pass of the component through the render batch of its UI root.
+             *
+             * Appends the same drawing as drawOverlay(), in the same order. Components drawing an overlay override it.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            virtual SFUI::Void drawOverlayBatched(SFUI::RenderBatch& renderBatch);
+
             /**
              * @brief Set a parent component for this component.
              *
@@ -120,6 +154,17 @@ namespace SFUI {
              */
             SFUI::Void addChildren(SFUI::Vector<SFUI::UniquePointer<SFUI::Component>> newChildren);
 
+            /**
+             * @brief Remove a child component and its subtree.
+             *
+             * Must not be called while the UI is handling an event.
+             *
+             * @param child Pointer to the child component to remove.
+             *
+             * @return Unique pointer to the detached child, or nullptr if it is not a child of this component.
+             */
+            SFUI::UniquePointer<SFUI::Component> removeChild(const SFUI::Component* child);
+
             /**
              * @brief Update a child's computed layout from the parent.
              *
@@ -127,6 +172,18 @@ namespace SFUI {
              */
             SFUI::Void updateChildFromParent(SFUI::Component::ComputedChildLayout computedChildLayout);
 
+            /**
+             * @brief Flag every computation stage of this component as dirty.
+             */
+            SFUI::Void markDirty();
+
+            /**
+             * @brief Check if any computation stage of this component is dirty.
+             *
+             * @return true if the component needs to be updated, false otherwise.
+             */
+            SFUI::Bool isDirty() const;
+
             /**
              * @brief Get the list of children.
              *
@@ -154,6 +211,72 @@ namespace SFUI {
              */
             const SFUI::Vector4f& getMargin() const;
 
+            /**
+             * @brief Get the bounds used to index this component for mouse event routing.
+             *
+             * The bounds must contain every point at which the component reacts to the mouse.
+             *
+             * @return Hit bounds of the component.
+             */
+            virtual SFUI::FloatRect getHitBounds() const;
+
+            /**
+             * @brief Get the layout box of the component shrunk by its padding.
+             *
+             * @return Content box of the component, the area its children and contents are clipped to.
+             */
+            SFUI::FloatRect getContentBox() const;
+
+            /**
+             * @brief Get the bounds of everything the component draws in the UI tree pass.
+             *
+             * Used to cull components lying outside of the render target or their ancestors' clip.
+             *
+             * @return Draw bounds of the component, including its shadow.
+             */
+            virtual SFUI::FloatRect getDrawBounds() const;
+
+            /**
+             * @brief Get a rectangle the component draws fully opaque in the UI tree pass.
+             *
+             * Used to skip drawing components hidden beneath opaque components drawn after them.
+             *
+             * @return Opaque rectangle, or an empty optional if none.
+             */
+            virtual SFUI::Optional<SFUI::FloatRect> getOpaqueBounds() const;
+
+            /**
+             * @brief Check if the component and its children are drawn through a cached texture layer.
+             *
+             * @return true if the cacheAsLayer style prop is set, false otherwise.
+             */
+            SFUI::Bool isCachedAsLayer() const;
+
+            /**
+             * @brief Check if the component must keep receiving mouse events while the cursor is outside of it.
+             *
+             * This is the case while it is hovered, pressed, or focused, so it can react to the mouse leaving or clicking elsewhere.
+             *
+             * @return true if the component is engaged with the mouse, false otherwise.
+             */
+            virtual SFUI::Bool isMouseEngaged() const;
+
+            /**
+             * @brief Check if the component must receive keyboard and text events.
+             *
+             * This is usually the case while it is focused.
+             *
+             * @return true if the component is engaged with the keyboard, false otherwise.
+             */
+            virtual SFUI::Bool isKeyboardEngaged() const;
+
+            /**
+             * @brief Get the event types consumed by the component's handleEvent().
+             *
+             * @return Event subscriptions of the component.
+             */
+            virtual SFUI::Component::EventSubscriptions getEventSubscriptions() const;
+
         protected:
             /**
              * @brief Alignment direction for component's children.
@@ -184,6 +307,30 @@ namespace SFUI {
                 SFUI::Vector4f margin;
             };
 
+            /**
+             * @brief Compiled layout props, refreshed only when the base layout changes.
+             */
+            struct CompiledLayout {
+                SFUI::Component::AlignDirection alignDirection = SFUI::Component::AlignDirection::Vertical;
+                SFUI::Component::AlignPrimary alignPrimary = SFUI::Component::AlignPrimary::Start;
+                SFUI::Component::AlignSecondary alignSecondary = SFUI::Component::AlignSecondary::Start;
+                SFUI::CompiledProp::Dimension width;
+                SFUI::CompiledProp::Dimension height;
+                SFUI::CompiledProp::UniQuad padding;
+                SFUI::CompiledProp::UniQuad margin;
+            };
+
+            /**
+             * @brief Compiled style props, refreshed only when the base style changes.
+             */
+            struct CompiledStyle {
+                SFUI::CompiledProp::Dimension borderWidth;
+                SFUI::CompiledProp::UniQuad cornerRadius;
+                SFUI::Color fillColor;
+                SFUI::Color borderColor;
+                SFUI::Color shadowFillColor;
+            };
+
             /**
              * @brief Computed layout for a child component.
              */
@@ -193,6 +340,26 @@ namespace SFUI {
                 SFUI::Vector4f margin;
             };
 
+            /**
+             * @brief Dirty state of each computation stage of the component.
+             */
+            struct DirtyFlags {
+                SFUI::Bool layout = true;
+                SFUI::Bool style = true;
+                SFUI::Bool geometry = true;
+                SFUI::Bool children = true;
+            };
+
+            /**
+             * @brief Settings of the UI containing the component, which its geometry is built with.
+             */
+            struct UpdateContext {
+                SFUI::MeshRegistry* meshRegistry = nullptr;
+                SFUI::Float arcDetail = 1.0f;
+                SFUI::Float shadowScale = 1.0f;
+                SFUI::Bool shadowRings = true;
+            };
+
             /**
              * @brief Computed style properties after resolving sub-properties.
              */
@@ -232,6 +399,11 @@ namespace SFUI {
              */
             SFUI::Vector2u renderTargetSize;
 
+            /**
+             * @brief Scissor clip inherited from the ancestors of this component, empty if unclipped.
+             */
+            SFUI::Optional<SFUI::FloatRect> clipBounds;
+
             /**
              * @brief Pointer to the parent component.
              */
@@ -242,40 +414,62 @@ namespace SFUI {
              */
             SFUI::Vector<SFUI::UniquePointer<SFUI::Component>> children;
 
+            /**
+             * @brief Computation stages that must be rerun on the next update.
+             */
+            SFUI::Component::DirtyFlags dirtyFlags;
+
+            /**
+             * @brief Whether children were added to or removed from the tree since the UIRoot last flattened it, only kept on the top-most ancestor.
+             */
+            SFUI::Bool treeStructureDirty = true;
+
+            /**
+             * @brief Whether opaque components drawn after this component hide it, set by the UIRoot's occlusion pass.
+             */
+            SFUI::Bool occluded = false;
+
+            /**
+             * @brief Whether the UIRoot's last update indexed this component again, which may have changed the clip of its children.
+             */
+            SFUI::Bool childClipRefreshed = false;
+
             /**
              * @brief List of animations to perform on the component's props.
              */
             SFUI::Vector<SFUI::Animation> animations;
 
             /**
-             * @brief Vertex arrays for rendering geometry with just rectangles.
+             * @brief Indexed mesh of the shadow, background and border geometry, in drawing order, built at the origin.
+             *
+             * Components with the same geometry inputs share the same mesh, empty until first built.
              */
-            SFUI::VertexArray backgroundRects;
+            SFUI::SharedPointer<const SFUI::Mesh> mesh;
 
             /**
-             * @brief Vertex arrays for rendering geometry with rounded corners.
+             * @brief Position the shared mesh is drawn at.
              */
-            SFUI::VertexArray backgroundArcs;
+            SFUI::Vector2f meshOffset;
 
             /**
-             * @brief Vertex arrays for rendering border geometry with just rectangles.
+             * @brief Geometry inputs the mesh was last built from, empty until first built.
              */
-            SFUI::VertexArray borderRects;
+            SFUI::Optional<SFUI::MeshRegistry::GeometryKey> cachedGeometryKey;
 
             /**
-             * @brief Vertex arrays for rendering border geometry with rounded corners.
+             * @brief Whether the base props have been committed at least once.
              */
-            SFUI::VertexArray borderArcs;
+            SFUI::Bool basePropsCommitted = false;
 
             /**
-             * @brief Vertex arrays for rendering shadow geometry with just rectangles.
+             * @brief Compiled base layout properties.
              */
-            SFUI::VertexArray shadowRects;
+            SFUI::Component::CompiledLayout compiledLayout;
 
             /**
-             * @brief Vertex arrays for rendering shadow geometry with rounded corners.
+             * @brief Compiled base style properties.
              */
-            SFUI::VertexArray shadowArcs;
+            SFUI::Component::CompiledStyle compiledStyle;
 
             /**
              * @brief Final computed layout properties.
@@ -293,6 +487,90 @@ namespace SFUI {
             SFUI::Vector<SFUI::Component::ComputedChildLayout> computedChildrenLayout;
 
         protected:
+            /**
+             * @brief Get the smallest rectangle containing two rectangles.
+             *
+             * @param a First rectangle.
+             * @param b Second rectangle.
+             *
+             * @return Union bounds of both rectangles.
+             */
+            static SFUI::FloatRect unionBounds(const SFUI::FloatRect& a, const SFUI::FloatRect& b);
+
+            /**
+             * @brief Draw the component's shared mesh at its position.
+             *
+             * @param drawTarget Target to draw on.
+             */
+            SFUI::Void drawMesh(SFUI::RenderTarget& drawTarget) const;
+
+            /**
+             * @brief Flag the layout and everything derived from it as dirty.
+             */
+            SFUI::Void markLayoutDirty();
+
+            /**
+             * @brief Flag the style and geometry as dirty.
+             */
+            SFUI::Void markStyleDirty();
+
+            /**
+             * @brief Flag the children layout as dirty.
+             */
+            SFUI::Void markChildrenDirty();
+
+            /**
+             * @brief Clear all dirty flags once the component has been updated.
+             */
+            SFUI::Void clearDirtyFlags();
+
+            /**
+             * @brief Commit the layout and style props into the base props, flagging what changed.
+             *
+             * @param layout Current layout props of the component.
+             * @param style Current style props of the component.
+             */
+            SFUI::Void commitBaseProps(const SFUI::PropGroup::Component::Layout& layout, const SFUI::PropGroup::Component::Style& style);
+
+            /**
+             * @brief Compile the committed base layout props into their numeric and enum forms.
+             */
+            SFUI::Void compileLayout();
+
+            /**
+             * @brief Compile the committed base style props into their numeric and color forms.
+             */
+            SFUI::Void compileStyle();
+
+            /**
+             * @brief Commit a component-specific prop group into its last committed snapshot.
+             *
+             * @param committedProps Last committed snapshot of the prop group, empty before the first commit.
+             * @param props Current prop group.
+             *
+             * @return true if the prop group changed since the last commit, false otherwise.
+             */
+            template<typename PropGroupType>
+            SFUI::Bool commitProps(SFUI::Optional<PropGroupType>& committedProps, const PropGroupType& props) {
+                if (committedProps && *committedProps == props) return false;
+                committedProps = props;
+                return true;
+            }
+
+            /**
+             * @brief Pre-update an inner component and flag this component dirty if the inner component changed.
+             *
+             * @param innerComponent Inner component owned by this component.
+             */
+            SFUI::Void preUpdateInnerComponent(SFUI::Component& innerComponent);
+
+            /**
+             * @brief Fully update an inner component after its props were channeled from this component.
+             *
+             * @param innerComponent Inner component owned by this component.
+             */
+            SFUI::Void updateInnerComponent(SFUI::Component& innerComponent);
+
             /**
              * @brief Check if the mouse is hovering over this component.
              *
@@ -313,14 +591,63 @@ namespace SFUI {
             SFUI::Color resolveColorSubProp(const SFUI::Prop::Color& color);
 
             /**
-             * @brief Resolve a Dimension sub-property to a 4-value float vector .
+             * @brief Resolve an optional Color sub-property, keeping it empty if not set.
+             *
+             * @param color Optional color sub-property.
+             *
+             * @return Resolved color, or an empty optional.
+             */
+            SFUI::Optional<SFUI::Color> compileOptionalColorSubProp(const SFUI::Optional<SFUI::Prop::Color>& color);
+
+            /**
+             * @brief Decode an RRGGBB or RRGGBBAA hex string without allocating.
+             *
+             * @param hexDigits Hex digits following the leading '#'.
+             * @param hexLength Number of hex digits.
+             *
+             * @return Decoded color.
+             */
+            SFUI::Color decodeHexColor(const char* hexDigits, SFUI::Size hexLength);
+
+            /**
+             * @brief Compile a Dimension sub-property into its tagged numeric form.
              *
              * @param dimension Dimension sub-property.
+             *
+             * @return Compiled dimension.
+             */
+            SFUI::CompiledProp::Dimension compileDimensionSubProp(const SFUI::Prop::Dimension& dimension);
+
+            /**
+             * @brief Compile a UniQuad sub-property into its tagged numeric form.
+             *
+             * @param subProp UniQuad sub-property.
+             *
+             * @return Compiled UniQuad.
+             */
+            SFUI::CompiledProp::UniQuad compileUniQuadSubProp(const SFUI::Prop::UniQuad& subProp);
+
+            /**
+             * @brief Resolve a compiled Dimension to a pixel value.
+             *
+             * @param dimension Compiled dimension.
              * @param reference Reference size for percentage calculations.
+             * @param maxFactor Upper clamp of the percentage fraction.
+             * @param fallback Value used for auto and invalid dimensions.
+             *
+             * @return Resolved pixel value.
+             */
+            SFUI::Float resolveDimensionSubProp(const SFUI::CompiledProp::Dimension& dimension, SFUI::Float reference, SFUI::Float maxFactor, SFUI::Float fallback = 0.0f);
+
+            /**
+             * @brief Resolve a compiled UniQuad to a 4-value float vector.
+             *
+             * @param size Size of the component for percentage calculations.
+             * @param subProp Compiled UniQuad sub-property.
              *
              * @return Resolved float vector.
              */
-            SFUI::Vector4f resolveUniQuadSubProp(const SFUI::Vector2f& size, const SFUI::Prop::UniQuad& subProp);
+            SFUI::Vector4f resolveUniQuadSubProp(const SFUI::Vector2f& size, const SFUI::CompiledProp::UniQuad& subProp);
 
             /**
              * @brief Compute the alignment properties.
@@ -363,61 +690,127 @@ namespace SFUI {
             SFUI::Void updateChildren();
 
         private:
+            /**
+             * @brief Bit marking an invalid entry of the hex digit lookup table.
+             */
+            static constexpr SFUI::UnsignedInt8 HEX_DIGIT_INVALID = 0x10;
+
+            /**
+             * @brief Hex digit lookup table used by the color decoder.
+             */
+            static const SFUI::Array<SFUI::UnsignedInt8, 256> HEX_DIGIT_VALUES;
+
+            /**
+             * @brief Settings of the UI the component was last updated in, or nullptr if never updated in one.
+             */
+            const SFUI::Component::UpdateContext* updateContext = nullptr;
+
+            /**
+             * @brief Flag the structure of the tree containing this component as changed.
+             */
+            SFUI::Void markTreeStructureDirty();
+
+            /**
+             * @brief Get the arc level of detail of the UI the component was last updated in.
+             *
+             * @return Level of detail of the tessellated arcs, 1 outside of a UI.
+             */
+            SFUI::Float getArcDetail() const;
+
+            /**
+             * @brief Get the share of the shadow radius drawn by the UI the component was last updated in.
+             *
+             * @return Shadow scale, 0 if shadows are dropped, 1 outside of a UI.
+             */
+            SFUI::Float getShadowScale() const;
+
+            /**
+             * @brief Check if the UI the component was last updated in builds shadows as gradient rings.
+             *
+             * @return true if shadows are single gradient rings, false if they are stacked layers, true outside of a UI.
+             */
+            SFUI::Bool usesShadowRings() const;
+
+            /**
+             * @brief Build the shadow, background and border geometry at the origin.
+             *
+             * @param geometry Mesh to build into.
+             */
+            SFUI::Void buildGeometry(SFUI::Mesh& geometry) const;
+
             /**
              * @brief Compute rectangular geometry for the component's main background.
              *
+             * @param geometry Mesh to add to.
              * @param position Top-left position of the background.
              * @param size Size of the background.
              */
-            SFUI::Void computeBackgroundRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size);
+            SFUI::Void computeBackgroundRectGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size) const;
 
             /**
              * @brief Compute arc geometry for the component's main background.
              *
+             * @param geometry Mesh to add to.
              * @param center Center position of the arc.
              * @param outerRadius Outer radius of the arc.
-             * @param startAngleDeg Starting angle in degrees.
-             * @param endAngleDeg Ending angle in degrees.
+             * @param startAngleDeg Starting angle in degrees, the quarter-circle arc ending 90 degrees later.
+             * @param arcResolution Number of segments of the arc.
              */
-            SFUI::Void computeBackgroundArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg);
+            SFUI::Void computeBackgroundArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Int arcResolution) const;
 
             /**
              * @brief Compute rectangular geometry for the component's border.
              *
+             * @param geometry Mesh to add to.
              * @param position Top-left position of the border.
              * @param size Size of the border.
              */
-            SFUI::Void computeBorderRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size);
+            SFUI::Void computeBorderRectGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size) const;
 
             /**
              * @brief Compute arc geometry for the component's border.
              *
+             * @param geometry Mesh to add to.
              * @param center Center position of the arc.
              * @param outerRadius Outer radius of the arc.
              * @param innerRadius Inner radius of the arc.
-             * @param startAngleDeg Starting angle in degrees.
-             * @param endAngleDeg Ending angle in degrees.
+             * @param startAngleDeg Starting angle in degrees, the quarter-circle arc ending 90 degrees later.
+             */
+            SFUI::Void computeBorderArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float innerRadius, SFUI::Float startAngleDeg) const;
+
+            /**
+             * @brief Compute the shadow as a single rounded-rect ring mesh with an alpha gradient.
+             *
+             * @param geometry Mesh to add to.
+             * @param position Top-left position of the outer contour.
+             * @param size Size of the outer contour.
+             * @param cornerRadius Corner radii of the outer contour.
+             * @param spread Inset of the inner contour, where the gradient ends.
+             * @param outerColor Shadow color at the outer contour.
+             * @param innerColor Shadow color at and inside the inner contour.
              */
-            SFUI::Void computeBorderArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float innerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg);
+            SFUI::Void computeShadowRingGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Vector4f cornerRadius, SFUI::Float spread, SFUI::Color outerColor, SFUI::Color innerColor) const;
 
             /**
-             * @brief Compute rectangular geometry for the component's shadow.
+             * @brief Compute the shadow as stacked rounded-rect layers, each inset from the last with its own alpha.
              *
-             * @param position Top-left position of the shadow.
-             * @param size Size of the shadow.
-             * @param modifiedShadowColor Color of the shadow with applied alpha.
+             * @param geometry Mesh to add to.
+             * @param position Top-left position of the largest layer.
+             * @param size Size of the largest layer.
+             * @param cornerRadius Corner radii of the largest layer.
+             * @param shadowLayers Number of layers.
              */
-            SFUI::Void computeShadowRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Color modifiedShadowColor);
+            SFUI::Void computeShadowLayersGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Vector4f cornerRadius, SFUI::Int shadowLayers) const;
 
             /**
-             * @brief Compute arc geometry for the component's shadow.
+             * @brief Compute quarter-circle arc geometry for a shadow layer.
              *
+             * @param geometry Mesh to add to.
              * @param center Center position of the arc.
-             * @param outerRadius Outer radius of the arc.
-             * @param startAngleDeg Starting angle in degrees.
-             * @param endAngleDeg Ending angle in degrees.
-             * @param modifiedShadowColor Color of the shadow with applied alpha.
+             * @param radius Radius of the arc.
+             * @param startAngleDeg Starting angle in degrees, the quarter-circle arc ending 90 degrees later.
+             * @param layerColor Shadow color of the layer.
              */
-            SFUI::Void computeShadowArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg, SFUI::Color modifiedShadowColor);
+            SFUI::Void computeShadowArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float radius, SFUI::Float startAngleDeg, SFUI::Color layerColor) const;
     };
 }
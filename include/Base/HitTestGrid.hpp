@@ -0,0 +1,153 @@
+/**
+ * @file HitTestGrid.hpp
+ * @brief Defines the HitTestGrid class used to route mouse events.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for HitTestGrid, a uniform
+ * grid spatial index over the clipped bounds of every component in a
+ * UI tree, used to find the components under the mouse cursor.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+
+
+namespace SFUI {
+
+    class Component;
+
+    /**
+     * @brief Uniform grid spatial index of component hit bounds.
+     *
+     * Each component is stored once with its clipped hit bounds and is
+     * referenced from every grid cell those bounds overlap. Entries can
+     * be moved individually when a component's layout changes.
+     */
+    class HitTestGrid {
+
+        public:
+            /**
+             * @brief Construct an empty hit-test grid.
+             *
+             * @param cellSize Side length of a grid cell in pixels.
+             */
+            HitTestGrid(SFUI::Float cellSize = 64.0f);
+
+            /**
+             * @brief Remove every entry and resize the grid to cover an area.
+             *
+             * @param areaSize Size of the area covered by the grid.
+             */
+            SFUI::Void reset(const SFUI::Vector2u& areaSize);
+
+            /**
+             * @brief Insert a component or move its existing entry.
+             *
+             * @param component Component to index.
+             * @param bounds Clipped hit bounds of the component, empty if fully clipped.
+             * @param childClip Clip rectangle applied to the component's children.
+             * @param order Traversal order of the component, used to order event dispatch.
+             */
+            SFUI::Void insert(SFUI::Component* component, const SFUI::Optional<SFUI::FloatRect>& bounds, const SFUI::FloatRect& childClip, SFUI::Size order);
+
+            /**
+             * @brief Check if a component has an entry in the grid.
+             *
+             * @param component Component to look up.
+             *
+             * @return true if indexed, false otherwise.
+             */
+            SFUI::Bool contains(const SFUI::Component* component) const;
+
+            /**
+             * @brief Get the clip rectangle applied to the children of an indexed component.
+             *
+             * @param component Indexed component.
+             *
+             * @return Clip rectangle of the component's children.
+             */
+            const SFUI::FloatRect& getChildClip(const SFUI::Component* component) const;
+
+            /**
+             * @brief Get the traversal order of an indexed component.
+             *
+             * @param component Indexed component.
+             *
+             * @return Traversal order of the component.
+             */
+            SFUI::Size getOrder(const SFUI::Component* component) const;
+
+            /**
+             * @brief Find every component whose hit bounds contain a point.
+             *
+             * @param point Point to test.
+             * @param hits Output list the hit components are appended to.
+             */
+            SFUI::Void query(const SFUI::Vector2f& point, SFUI::Vector<SFUI::Component*>& hits) const;
+
+            /**
+             * @brief Get the number of indexed components.
+             *
+             * @return Number of entries.
+             */
+            SFUI::Size getEntryCount() const;
+
+        private:
+            /**
+             * @brief Indexed component with its bounds and covered cell range.
+             */
+            struct Entry {
+                SFUI::Component* component;
+                SFUI::Optional<SFUI::FloatRect> bounds;
+                SFUI::FloatRect childClip;
+                SFUI::Size order;
+                SFUI::Vector2u firstCell;
+                SFUI::Vector2u lastCell;
+            };
+
+            /**
+             * @brief Side length of a grid cell in pixels.
+             */
+            SFUI::Float cellSize;
+
+            /**
+             * @brief Number of grid cells along each axis.
+             */
+            SFUI::Vector2u cellCount;
+
+            /**
+             * @brief All indexed entries.
+             */
+            SFUI::Vector<SFUI::HitTestGrid::Entry> entries;
+
+            /**
+             * @brief Entry index of each indexed component.
+             */
+            SFUI::UnorderedMap<const SFUI::Component*, SFUI::Size> entryIndices;
+
+            /**
+             * @brief Entry indices referenced by each grid cell, stored row by row.
+             */
+            SFUI::Vector<SFUI::Vector<SFUI::Size>> cells;
+
+        private:
+            /**
+             * @brief Reference an entry from every cell its bounds overlap.
+             *
+             * @param entryIndex Index of the entry.
+             */
+            SFUI::Void addToCells(SFUI::Size entryIndex);
+
+            /**
+             * @brief Remove an entry from every cell it is referenced by.
+             *
+             * @param entryIndex Index of the entry.
+             */
+            SFUI::Void removeFromCells(SFUI::Size entryIndex);
+    };
+}
@@ -0,0 +1,178 @@
+/**
+ * @file LayerCache.hpp
+ * @brief Defines the LayerCache class holding the cached texture layers of the UI tree.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for LayerCache, which keeps
+ * the render textures that subtrees cached as layers are drawn into,
+ * within a global memory budget and with least recently used eviction.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+
+
+namespace SFUI {
+
+    class Component;
+
+    /**
+     * @brief Memory-bounded cache of the texture layers of the UI tree.
+     *
+     * Each component cached as a layer owns a render texture covering its draw
+     * bounds. A layer stays valid until a component of its subtree changes or
+     * its bounds move. Once the layers exceed the budget, the least recently
+     * drawn ones are evicted at the end of the frame.
+     */
+    class LayerCache {
+
+        public:
+            /**
+             * @brief Memory statistics of the layers.
+             */
+            struct Statistics {
+                SFUI::Size layerCount = 0;
+                SFUI::Size layerBytes = 0;
+                SFUI::Size budgetBytes = 0;
+                SFUI::Size renderedLayers = 0;
+                SFUI::Size evictedLayers = 0;
+            };
+
+            /**
+             * @brief Texture layer of a component and its children.
+             */
+            struct Layer {
+                SFUI::RenderTexture renderTexture;
+                SFUI::FloatRect bounds;
+                SFUI::Size lastUsedFrame = 0;
+                SFUI::Bool valid = false;
+            };
+
+        public:
+            /**
+             * @brief Default memory budget of the layers, in bytes.
+             */
+            static constexpr SFUI::Size DEFAULT_BUDGET_BYTES = 64 * 1024 * 1024;
+
+        public:
+            /**
+             * @brief Construct an empty layer cache.
+             */
+            LayerCache();
+
+            /**
+             * @brief Set the memory budget of the layers, evicting the least recently used ones at the end of the frame.
+             *
+             * @param budgetBytes Budget in bytes.
+             */
+            SFUI::Void setBudget(SFUI::Size budgetBytes);
+
+            /**
+             * @brief Start a frame, resetting the per-frame statistics.
+             */
+            SFUI::Void beginFrame();
+
+            /**
+             * @brief End a frame, evicting the least recently used layers while over budget.
+             */
+            SFUI::Void endFrame();
+
+            /**
+             * @brief Get the layer of a component, creating or resizing it to its draw bounds.
+             *
+             * @param component Component cached as a layer.
+             * @param drawBounds Draw bounds of the component.
+             *
+             * @return Layer to draw, invalid if it must be redrawn, or nullptr if the component must be drawn directly.
+             */
+            SFUI::LayerCache::Layer* acquire(const SFUI::Component* component, const SFUI::FloatRect& drawBounds);
+
+            /**
+             * @brief Flag a layer as drawn and up to date.
+             *
+             * @param layer Layer that was drawn into.
+             */
+            SFUI::Void validate(SFUI::LayerCache::Layer& layer);
+
+            /**
+             * @brief Flag the layer of a component as outdated, if it has one.
+             *
+             * @param component Component whose subtree changed.
+             */
+            SFUI::Void invalidate(const SFUI::Component* component);
+
+            /**
+             * @brief Free the layer of a component, if it has one.
+             *
+             * @param component Component that no longer needs a layer.
+             */
+            SFUI::Void release(const SFUI::Component* component);
+
+            /**
+             * @brief Free the layers of components that are not part of the UI tree anymore.
+             *
+             * @param components Components of the UI tree.
+             */
+            SFUI::Void prune(const SFUI::Vector<SFUI::Component*>& components);
+
+            /**
+             * @brief Check if no layer is cached.
+             *
+             * @return true if empty, false otherwise.
+             */
+            SFUI::Bool isEmpty() const;
+
+            /**
+             * @brief Get the memory statistics of the layers.
+             *
+             * @return Layer count and memory, budget, and the layers rendered and evicted in the current frame.
+             */
+            SFUI::LayerCache::Statistics getStatistics() const;
+
+        private:
+            /**
+             * @brief Cached layer of each component.
+             */
+            SFUI::UnorderedMap<const SFUI::Component*, SFUI::UniquePointer<SFUI::LayerCache::Layer>> layers;
+
+            /**
+             * @brief Memory budget of the layers, in bytes.
+             */
+            SFUI::Size budgetBytes = DEFAULT_BUDGET_BYTES;
+
+            /**
+             * @brief Memory used by the layers, in bytes.
+             */
+            SFUI::Size layerBytes = 0;
+
+            /**
+             * @brief Number of the current frame, used to find the least recently used layers.
+             */
+            SFUI::Size frame = 0;
+
+            /**
+             * @brief Number of layers drawn into in the current frame.
+             */
+            SFUI::Size renderedLayers = 0;
+
+            /**
+             * @brief Number of layers evicted at the end of the current frame.
+             */
+            SFUI::Size evictedLayers = 0;
+
+        private:
+            /**
+             * @brief Get the memory used by a render texture.
+             *
+             * @param size Size of the render texture in pixels.
+             *
+             * @return Memory used in bytes, at 4 bytes per pixel.
+             */
+            static SFUI::Size getByteSize(const SFUI::Vector2u& size);
+    };
+}
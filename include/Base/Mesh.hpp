@@ -0,0 +1,235 @@
+/**
+ * @file Mesh.hpp
+ * @brief Defines the Mesh class holding the drawable geometry of a component.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for Mesh, an indexed triangle
+ * mesh of unique position and color vertices that covers the shadow,
+ * background and border geometry of a component.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include <cstdint>
+
+
+namespace SFUI {
+
+    /**
+     * @brief Indexed triangle mesh of untextured, colored vertices.
+     *
+     * Vertices shared by several triangles, like the center of an arc fan or
+     * the corners of a quad, are stored once and referenced by 16-bit indices.
+     * Triangles are drawn in the order they were added.
+     */
+    class Mesh : public SFUI::Drawable {
+
+        public:
+            /**
+             * @brief Index of a vertex in the mesh.
+             *
+             * Component meshes stay far below 65536 vertices, since arcs are tessellated with at most ArcTessellator::maxResolution segments.
+             */
+            using Index = std::uint16_t;
+
+            /**
+             * @brief Mesh vertex, without the texture coordinates of an sf::Vertex.
+             */
+            struct Vertex {
+                SFUI::Vector2f position;
+                SFUI::Color color;
+            };
+
+        public:
+            /**
+             * @brief Construct an empty mesh.
+             */
+            Mesh();
+
+            /**
+             * @brief Remove every vertex and triangle.
+             */
+            SFUI::Void clear();
+
+            /**
+             * @brief Check if the mesh has no triangles.
+             *
+             * @return True if empty, false otherwise.
+             */
+            SFUI::Bool isEmpty() const;
+
+            /**
+             * @brief Add a vertex.
+             *
+             * @param position Position of the vertex.
+             * @param color Color of the vertex.
+             *
+             * @return Index of the added vertex.
+             */
+            SFUI::Mesh::Index addVertex(const SFUI::Vector2f& position, const SFUI::Color& color);
+
+            /**
+             * @brief Add a triangle between three vertices.
+             *
+             * @param a Index of the first vertex.
+             * @param b Index of the second vertex.
+             * @param c Index of the third vertex.
+             */
+            SFUI::Void addTriangle(SFUI::Mesh::Index a, SFUI::Mesh::Index b, SFUI::Mesh::Index c);
+
+            /**
+             * @brief Add an axis-aligned rectangle of a single color.
+             *
+             * @param position Top-left position of the rectangle.
+             * @param size Size of the rectangle.
+             * @param color Color of the rectangle.
+             */
+            SFUI::Void addRect(const SFUI::Vector2f& position, const SFUI::Vector2f& size, const SFUI::Color& color);
+
+            /**
+             * @brief Move every vertex by an offset.
+             *
+             * @param offset Offset to move by.
+             */
+            SFUI::Void translate(const SFUI::Vector2f& offset);
+
+            /**
+             * @brief Get the unique vertices of the mesh.
+             *
+             * @return Vertices, in the order they were added.
+             */
+            const SFUI::Vector<SFUI::Mesh::Vertex>& getVertices() const;
+
+            /**
+             * @brief Get the triangle indices of the mesh, three per triangle.
+             *
+             * @return Indices, in drawing order.
+             */
+            const SFUI::Vector<SFUI::Mesh::Index>& getIndices() const;
+
+            /**
+             * @brief Get the version of the mesh, which changes on every modification.
+             *
+             * Versions are unique across all meshes, so a mesh and version pair identifies its content.
+             *
+             * @return Version of the mesh.
+             */
+            SFUI::Size getVersion() const;
+
+            /**
+             * @brief Get the area covered by the triangles of the mesh, counting overlapping triangles once each.
+             *
+             * @return Area in square pixels, which is the number of pixels the mesh shades.
+             */
+            SFUI::Float getArea() const;
+
+            /**
+             * @brief Get the axis-aligned bounding box of the vertices of the mesh.
+             *
+             * @return Bounding box, or an empty rectangle if the mesh is empty.
+             */
+            SFUI::FloatRect getBounds() const;
+
+            /**
+             * @brief Append the triangles of the mesh to a triangle vertex array.
+             *
+             * @param triangles Vertex array using the Triangles primitive type.
+             * @param offset Offset the vertices are moved by.
+             */
+            SFUI::Void appendTo(SFUI::VertexArray& triangles, const SFUI::Vector2f& offset = SFUI::Vector2f()) const;
+
+            /**
+             * @brief Append the triangles of the mesh, cut to a clip rectangle, to a triangle vertex array.
+             *
+             * @param triangles Vertex array using the Triangles primitive type.
+             * @param clipRect Clip rectangle the moved triangles are cut to.
+             * @param offset Offset the vertices are moved by.
+             */
+            SFUI::Void appendClippedTo(SFUI::VertexArray& triangles, const SFUI::FloatRect& clipRect, const SFUI::Vector2f& offset = SFUI::Vector2f()) const;
+
+        protected:
+            /**
+             * @brief Draw the mesh to a render target.
+             *
+             * @param drawTarget Target to draw on.
+             * @param states Render states to draw with.
+             */
+            SFUI::Void draw(SFUI::RenderTarget& drawTarget, SFUI::RenderStates states) const override;
+
+        private:
+            /**
+             * @brief Give the mesh a new version after a modification.
+             */
+            SFUI::Void markModified();
+
+            /**
+             * @brief Cut a convex polygon by an axis-aligned edge of a clip rectangle.
+             *
+             * @param input Vertices of the polygon.
+             * @param inputCount Number of vertices of the polygon.
+             * @param output Vertices of the cut polygon, with room for one more vertex than the input.
+             * @param vertical Whether the edge is vertical, cutting along the x-axis.
+             * @param edge Coordinate of the edge.
+             * @param keepAbove Whether the part above the edge coordinate is kept, or the part below.
+             *
+             * @return Number of vertices of the cut polygon.
+             */
+            static SFUI::Size clipPolygon(const SFUI::Vertex* input, SFUI::Size inputCount, SFUI::Vertex* output, SFUI::Bool vertical, SFUI::Float edge, SFUI::Bool keepAbove);
+
+        private:
+            /**
+             * @brief Unique vertices of the mesh.
+             */
+            SFUI::Vector<SFUI::Mesh::Vertex> vertices;
+
+            /**
+             * @brief Triangle indices of the mesh.
+             */
+            SFUI::Vector<SFUI::Mesh::Index> indices;
+
+            /**
+             * @brief Version of the mesh content.
+             */
+            SFUI::Size version;
+
+            /**
+             * @brief Next version handed out to a modified mesh.
+             */
+            static SFUI::Size nextVersion;
+
+            /**
+             * @brief Triangles expanded for direct drawing, rebuilt after the mesh changes.
+             */
+            mutable SFUI::VertexArray expandedTriangles;
+
+            /**
+             * @brief Whether the expanded triangles match the mesh.
+             */
+            mutable SFUI::Bool expandedTrianglesValid = false;
+
+            /**
+             * @brief Area covered by the triangles, computed on demand.
+             */
+            mutable SFUI::Float area = 0.0f;
+
+            /**
+             * @brief Whether the area matches the mesh.
+             */
+            mutable SFUI::Bool areaValid = false;
+
+            /**
+             * @brief Bounding box of the vertices, computed on demand.
+             */
+            mutable SFUI::FloatRect bounds;
+
+            /**
+             * @brief Whether the bounding box matches the mesh.
+             */
+            mutable SFUI::Bool boundsValid = false;
+    };
+}
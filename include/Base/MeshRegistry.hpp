@@ -0,0 +1,115 @@
+/**
+ * @file MeshRegistry.hpp
+ * @brief Defines the MeshRegistry class sharing meshes between components of a UI.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for MeshRegistry, which maps
+ * the geometry inputs of components to the meshes built from them, so
+ * that components with identical geometry share a single mesh.
+ */
+
+
+#pragma once
+#include "Base/Mesh.hpp"
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Registry of the meshes shared between the components of a UI.
+     *
+     * Each UIRoot owns its registry. It is not synchronized, and is only meant to be
+     * used from the thread updating that UI. Meshes are held weakly, so a mesh is
+     * freed with the last component using it, and its expired entry is pruned once
+     * the registry has doubled in size.
+     */
+    class MeshRegistry {
+
+        public:
+            /**
+             * @brief Computed inputs of the drawable geometry of a component.
+             */
+            struct GeometryKey {
+                SFUI::Vector2f size;
+                SFUI::Vector2i position;
+                SFUI::Vector4f cornerRadius;
+                SFUI::Float borderWidth;
+                SFUI::Color fillColor;
+                SFUI::Color borderColor;
+                SFUI::Vector2f shadowOffset;
+                SFUI::Float shadowRadius;
+                SFUI::Color shadowFillColor;
+                SFUI::Float arcDetail;
+                SFUI::Bool shadowRings;
+                bool operator==(const GeometryKey&) const = default;
+            };
+
+            /**
+             * @brief Hash of the geometry inputs.
+             */
+            struct GeometryKeyHash {
+                SFUI::Size operator()(const SFUI::MeshRegistry::GeometryKey& geometryKey) const;
+            };
+
+        public:
+            /**
+             * @brief Size of the registry at which its expired entries are first pruned.
+             */
+            static constexpr SFUI::Size MIN_PRUNE_SIZE = 64;
+
+        public:
+            /**
+             * @brief Construct an empty registry.
+             */
+            MeshRegistry();
+
+            /**
+             * @brief Find the mesh built from geometry inputs.
+             *
+             * @param geometryKey Geometry inputs, at the origin.
+             *
+             * @return Shared mesh, or nullptr if none is registered or the inputs are not finite.
+             */
+            SFUI::SharedPointer<const SFUI::Mesh> find(const SFUI::MeshRegistry::GeometryKey& geometryKey) const;
+
+            /**
+             * @brief Register the mesh built from geometry inputs, unless the inputs are not finite.
+             *
+             * @param geometryKey Geometry inputs, at the origin.
+             * @param mesh Mesh built from the inputs.
+             */
+            SFUI::Void insert(const SFUI::MeshRegistry::GeometryKey& geometryKey, const SFUI::SharedPointer<const SFUI::Mesh>& mesh);
+
+            /**
+             * @brief Get the number of registered meshes still used by a component.
+             *
+             * @return Number of shared meshes.
+             */
+            SFUI::Size getMeshCount() const;
+
+            /**
+             * @brief Check if every geometry input is finite, which a key must be to equal itself.
+             *
+             * @param geometryKey Geometry inputs.
+             *
+             * @return true if no input is infinite or NaN, false otherwise.
+             */
+            static SFUI::Bool isFinite(const SFUI::MeshRegistry::GeometryKey& geometryKey);
+
+        private:
+            /**
+             * @brief Meshes by the geometry inputs they were built from at the origin.
+             */
+            SFUI::UnorderedMap<SFUI::MeshRegistry::GeometryKey, SFUI::WeakPointer<const SFUI::Mesh>, SFUI::MeshRegistry::GeometryKeyHash> meshes;
+
+            /**
+             * @brief Size of the registry at which its expired entries are pruned.
+             */
+            SFUI::Size pruneSize = MIN_PRUNE_SIZE;
+    };
+}
@@ -0,0 +1,165 @@
+/**
+ * @file QualityController.hpp
+ * @brief Defines the QualityController class adapting the rendering quality to a frame budget.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for QualityController, which
+ * measures the cost of each frame against a budget and decides when the
+ * UI must trade rendering quality for speed, and when it can restore it.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Frame budget driven quality level selector.
+     *
+     * The frame cost is smoothed over recent frames. A level is dropped when the
+     * smoothed cost stays over budget for a few frames, and restored when it stays
+     * well under budget for much longer. Restoring a level that immediately proves
+     * too expensive doubles the wait before the next restore, so the quality does
+     * not keep oscillating around the budget.
+     */
+    class QualityController {
+
+        public:
+            /**
+             * @brief Rendering quality levels, each one keeping the reductions of the levels above it.
+             */
+            enum class Level {
+                Full,
+                Composited,
+                CoarseArcs,
+                ReducedShadows,
+                NoShadows
+            };
+
+            /**
+             * @brief Change from one quality level to another.
+             */
+            struct Transition {
+                SFUI::QualityController::Level previousLevel;
+                SFUI::QualityController::Level level;
+                SFUI::Time averageFrameTime;
+                SFUI::Time budget;
+            };
+
+            /**
+             * @brief Callback triggered on each quality transition.
+             */
+            using TransitionCallback = SFUI::Function<SFUI::Void(const SFUI::QualityController::Transition&)>;
+
+        public:
+            /**
+             * @brief Default frame budget, for 60 frames per second.
+             */
+            static const SFUI::Time DEFAULT_BUDGET;
+
+            /**
+             * @brief Weight of the latest frame in the smoothed frame cost.
+             */
+            static constexpr SFUI::Float SMOOTHING = 0.1f;
+
+            /**
+             * @brief Share of the budget the smoothed frame cost must stay under to restore quality.
+             */
+            static constexpr SFUI::Float HEADROOM = 0.6f;
+
+            /**
+             * @brief Consecutive frames over budget before the quality is reduced.
+             */
+            static constexpr SFUI::Size REDUCE_FRAMES = 10;
+
+            /**
+             * @brief Consecutive frames with headroom before the quality is restored.
+             */
+            static constexpr SFUI::Size RESTORE_FRAMES = 120;
+
+            /**
+             * @brief Most consecutive frames with headroom required before the quality is restored.
+             */
+            static constexpr SFUI::Size MAX_RESTORE_FRAMES = 1920;
+
+        public:
+            /**
+             * @brief Construct a controller at full quality with the default budget.
+             */
+            QualityController();
+
+            /**
+             * @brief Set the frame budget.
+             *
+             * @param budget Largest frame cost allowed.
+             */
+            SFUI::Void setBudget(SFUI::Time budget);
+
+            /**
+             * @brief Go back to full quality and forget the measured frames.
+             */
+            SFUI::Void reset();
+
+            /**
+             * @brief Measure a frame, changing the quality level if needed.
+             *
+             * @param frameCost Cost of the frame.
+             *
+             * @return Transition made, or an empty optional if the level did not change.
+             */
+            SFUI::Optional<SFUI::QualityController::Transition> addFrame(SFUI::Time frameCost);
+
+            /**
+             * @brief Get the current quality level.
+             *
+             * @return Current quality level.
+             */
+            SFUI::QualityController::Level getLevel() const;
+
+        private:
+            /**
+             * @brief Current quality level.
+             */
+            SFUI::QualityController::Level level = SFUI::QualityController::Level::Full;
+
+            /**
+             * @brief Largest frame cost allowed.
+             */
+            SFUI::Time budget;
+
+            /**
+             * @brief Smoothed cost of the recent frames.
+             */
+            SFUI::Time averageFrameTime;
+
+            /**
+             * @brief Number of frames measured.
+             */
+            SFUI::Size frameCount = 0;
+
+            /**
+             * @brief Consecutive frames over budget.
+             */
+            SFUI::Size framesOverBudget = 0;
+
+            /**
+             * @brief Consecutive frames with headroom.
+             */
+            SFUI::Size framesWithHeadroom = 0;
+
+            /**
+             * @brief Consecutive frames with headroom currently required to restore quality.
+             */
+            SFUI::Size restoreFrames = RESTORE_FRAMES;
+
+            /**
+             * @brief Number of the frame quality was last restored on.
+             */
+            SFUI::Optional<SFUI::Size> lastRestoreFrame;
+    };
+}
@@ -0,0 +1,145 @@
+/**
+ * @file RecordingRenderBackend.hpp
+ * @brief Defines the RecordingRenderBackend class measuring the draw commands of the UI.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for RecordingRenderBackend, a
+ * render backend that draws nothing and only counts the draw calls,
+ * vertices and state changes of replayed draw commands, so that drawing
+ * can be measured without a window or an OpenGL context.
+ *
+ * Texts are the exception: laying out a label rasterizes its glyphs into
+ * the font's texture pages, which already needs an OpenGL context during
+ * the update. A tree with texts can only be recorded where one exists.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include "RenderBackend.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Render backend counting the draw commands it receives without drawing them.
+     *
+     * The statistics add up over every replay until they are reset, so a frame
+     * drawn through several command lists is measured as a whole.
+     */
+    class RecordingRenderBackend : public SFUI::RenderBackend {
+
+        public:
+            /**
+             * @brief Counts of the replayed draw commands.
+             */
+            struct Statistics {
+                SFUI::Size drawCalls = 0;
+                SFUI::Size vertices = 0;
+                SFUI::Size clipChanges = 0;
+                SFUI::Size textureChanges = 0;
+                SFUI::Size replays = 0;
+            };
+
+        public:
+            /**
+             * @brief Construct a backend with zeroed statistics.
+             */
+            RecordingRenderBackend();
+
+            /**
+             * @brief Start counting a replay, without clipping.
+             */
+            SFUI::Void begin() override;
+
+            /**
+             * @brief Finish counting a replay.
+             */
+            SFUI::Void end() override;
+
+            /**
+             * @brief Count a change of the clip rectangle.
+             *
+             * @param clipRect Clip rectangle in render target coordinates, or an empty optional to disable clipping.
+             */
+            SFUI::Void setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) override;
+
+            /**
+             * @brief Count a draw call of triangles from memory.
+             *
+             * @param vertices First vertex of the triangles.
+             * @param vertexCount Number of vertices.
+             * @param texture Texture of the triangles, or nullptr if untextured.
+             */
+            SFUI::Void drawVertices(const SFUI::Vertex* vertices, SFUI::Size vertexCount, const SFUI::Texture* texture) override;
+
+            /**
+             * @brief Count a draw call of triangles from a vertex buffer.
+             *
+             * @param vertexBuffer Vertex buffer holding the triangles.
+             * @param vertexCount Number of vertices drawn from the start of the buffer.
+             */
+            SFUI::Void drawVertexBuffer(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) override;
+
+            /**
+             * @brief Count a draw call of a drawable.
+             *
+             * @param drawable Drawable to draw.
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void drawDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) override;
+
+            /**
+             * @brief Check if the backend draws through an OpenGL context.
+             *
+             * @return false, since nothing is drawn.
+             */
+            SFUI::Bool hasGraphicsContext() const override;
+
+            /**
+             * @brief Zero the statistics.
+             */
+            SFUI::Void reset();
+
+            /**
+             * @brief Get the statistics counted since construction or the last reset().
+             *
+             * @return Draw call, vertex, clip change, texture change and replay counts.
+             */
+            SFUI::RecordingRenderBackend::Statistics getStatistics() const;
+
+        private:
+            /**
+             * @brief Statistics counted since construction or the last reset().
+             */
+            SFUI::RecordingRenderBackend::Statistics statistics;
+
+            /**
+             * @brief Clip rectangle of the following draws.
+             */
+            SFUI::Optional<SFUI::FloatRect> clip;
+
+            /**
+             * @brief Texture of the last draw call, or nullptr if untextured.
+             */
+            const SFUI::Texture* texture = nullptr;
+
+            /**
+             * @brief Whether the texture of the last draw call is known, which it is not after a drawable.
+             */
+            SFUI::Bool textureKnown = false;
+
+        private:
+            /**
+             * @brief Count a draw call and a texture change if its texture differs from the last one.
+             *
+             * @param drawTexture Texture of the draw call, or nullptr if untextured.
+             * @param vertexCount Number of vertices drawn.
+             */
+            SFUI::Void countDraw(const SFUI::Texture* drawTexture, SFUI::Size vertexCount);
+    };
+}
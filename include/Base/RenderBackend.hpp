@@ -0,0 +1,85 @@
+/**
+ * @file RenderBackend.hpp
+ * @brief Defines the RenderBackend interface replaying the draw commands of the UI.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the interface definition for RenderBackend, which
+ * receives the recorded draw commands of a frame, either to draw them on
+ * a render target or to measure them without a graphics context.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Receiver of the draw commands replayed from a render command list.
+     *
+     * A replay starts with begin(), unclipped, and ends with end(). All vertices
+     * are triangles in render target coordinates.
+     */
+    class RenderBackend {
+
+        public:
+            virtual ~RenderBackend() = default;
+
+            /**
+             * @brief Start replaying a command list, without clipping.
+             */
+            virtual SFUI::Void begin() = 0;
+
+            /**
+             * @brief Finish replaying a command list, disabling clipping.
+             */
+            virtual SFUI::Void end() = 0;
+
+            /**
+             * @brief Restrict the following draws to a rectangle.
+             *
+             * @param clipRect Clip rectangle in render target coordinates, or an empty optional to disable clipping.
+             */
+            virtual SFUI::Void setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) = 0;
+
+            /**
+             * @brief Draw triangles from memory.
+             *
+             * @param vertices First vertex of the triangles.
+             * @param vertexCount Number of vertices.
+             * @param texture Texture of the triangles, or nullptr if untextured.
+             */
+            virtual SFUI::Void drawVertices(const SFUI::Vertex* vertices, SFUI::Size vertexCount, const SFUI::Texture* texture) = 0;
+
+            /**
+             * @brief Draw triangles from a vertex buffer.
+             *
+             * @param vertexBuffer Vertex buffer holding the triangles.
+             * @param vertexCount Number of vertices drawn from the start of the buffer.
+             */
+            virtual SFUI::Void drawVertexBuffer(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) = 0;
+
+            /**
+             * @brief Draw a drawable, such as a sprite or a text.
+             *
+             * @param drawable Drawable to draw.
+             * @param renderStates Render states to draw with.
+             */
+            virtual SFUI::Void drawDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) = 0;
+
+            /**
+             * @brief Check if the backend draws through an OpenGL context.
+             *
+             * Without one, no GPU resource such as a vertex buffer or a glyph texture page
+             * may be created or updated while recording for this backend.
+             *
+             * @return true if an OpenGL context is available, false otherwise.
+             */
+            virtual SFUI::Bool hasGraphicsContext() const = 0;
+    };
+}
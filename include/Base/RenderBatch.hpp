@@ -0,0 +1,318 @@
+/**
+ * @file RenderBatch.hpp
+ * @brief Defines the RenderBatch class used to draw the UI tree.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for RenderBatch, which gathers
+ * the untextured triangle geometry and the text glyphs of the UI tree into
+ * as few draw calls as possible, in painter's order, records them into a
+ * command list replayed on a render backend, and counts the draw calls of
+ * a frame.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include "ClipStack.hpp"
+#include "Mesh.hpp"
+#include "RenderBackend.hpp"
+#include "RenderCommandList.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Painter's order draw call batcher for the UI tree.
+     *
+     * Appended triangle geometry is merged into a single vertex stream
+     * until a clip rectangle change, appended text or a textured drawable
+     * (sprite) forces the stream to be flushed, which keeps the drawing order
+     * identical to drawing every vertex array on its own. Appended texts are
+     * merged into a single glyph stream while they share a glyph texture.
+     *
+     * Nothing is drawn while the frame is recorded: the draw calls are recorded
+     * into a command list, which is replayed on the backend at the end of the frame.
+     */
+    class RenderBatch {
+
+        public:
+            /**
+             * @brief Drawing statistics of a frame.
+             */
+            struct FrameStatistics {
+                SFUI::Size requestedDrawCalls = 0;
+                SFUI::Size issuedDrawCalls = 0;
+                SFUI::Size culledComponents = 0;
+                SFUI::Size uploadedVertices = 0;
+                SFUI::Size occludedComponents = 0;
+                SFUI::Float drawnArea = 0.0f;
+            };
+
+        public:
+            /**
+             * @brief Construct an empty render batch.
+             */
+            RenderBatch();
+
+            /**
+             * @brief Start recording a frame of drawing.
+             *
+             * @param backend Backend the recorded frame is replayed on by end(), which must outlive it.
+             * @param batching Whether geometry is merged, or drawn one vertex array at a time.
+             */
+            SFUI::Void begin(SFUI::RenderBackend& backend, SFUI::Bool batching);
+
+            /**
+             * @brief Flush the pending geometry and replay the recorded frame on the backend.
+             */
+            SFUI::Void end();
+
+            /**
+             * @brief Enable or disable keeping the batched geometry in GPU vertex buffers between frames.
+             *
+             * Has no effect if vertex buffers are not supported by the system. Frames recorded for a backend
+             * without an OpenGL context are never retained, since uploads happen while recording.
+             *
+             * @param retained Whether batched geometry is retained on the GPU.
+             */
+            SFUI::Void setRetained(SFUI::Bool retained);
+
+            /**
+             * @brief Enable or disable cutting appended geometry to the current clip on the CPU.
+             *
+             * Clipped geometry needs no scissor box, so geometry under different clips is merged into
+             * the same draw call. Only textured drawables are still clipped with the scissor box.
+             *
+             * @param vertexClipping Whether geometry is clipped on the CPU.
+             */
+            SFUI::Void setVertexClipping(SFUI::Bool vertexClipping);
+
+            /**
+             * @brief Restrict the following draws to a rectangle, intersected with the current clip.
+             *
+             * @param clipRect Clip rectangle in render target coordinates.
+             */
+            SFUI::Void pushClip(const SFUI::FloatRect& clipRect);
+
+            /**
+             * @brief Restore the clip that was active before the last pushClip().
+             */
+            SFUI::Void popClip();
+
+            /**
+             * @brief Append the triangles of a mesh to the batch.
+             *
+             * @param mesh Mesh to append.
+             * @param offset Position the mesh is drawn at.
+             */
+            SFUI::Void append(const SFUI::Mesh& mesh, const SFUI::Vector2f& offset);
+
+            /**
+             * @brief Append the glyphs of a text to the batch, clipped on the CPU to the current clip.
+             *
+             * Consecutive texts sharing a glyph texture, which are those of a same font and character size,
+             * are merged into one draw call whatever their clip. Rotated, mirrored, italic, underlined, struck
+             * through and outlined texts are drawn on their own with the scissor box instead.
+             *
+             * Merging reads the glyphs from the font, which may rasterize and upload them, so on a backend
+             * without an OpenGL context the text is recorded as a drawable and left untouched instead.
+             *
+             * @param text Text to append.
+             */
+            SFUI::Void appendText(const SFUI::Text& text);
+
+            /**
+             * @brief Draw a textured drawable, flushing the pending geometry first.
+             *
+             * @param drawable Text or other drawable to draw, which must outlive end().
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void draw(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates = SFUI::RenderStates::Default);
+
+            /**
+             * @brief Draw a copy of a sprite, flushing the pending geometry first.
+             *
+             * @param sprite Sprite to draw.
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void draw(const SFUI::Sprite& sprite, const SFUI::RenderStates& renderStates = SFUI::RenderStates::Default);
+
+            /**
+             * @brief Count components skipped because they lie outside of the current clip.
+             *
+             * @param componentCount Number of culled components.
+             */
+            SFUI::Void countCulled(SFUI::Size componentCount);
+
+            /**
+             * @brief Count a component skipped because opaque components drawn after it cover it.
+             */
+            SFUI::Void countOccluded();
+
+            /**
+             * @brief Get the current clip rectangle, used to cull components.
+             *
+             * @return The effective clip, or an empty optional if unclipped.
+             */
+            SFUI::Optional<SFUI::FloatRect> getClip() const;
+
+            /**
+             * @brief Get the statistics counted since the last begin().
+             *
+             * @return Draw call counts, culled and occluded component counts, uploaded vertex count and drawn geometry area.
+             */
+            SFUI::RenderBatch::FrameStatistics getFrameStatistics() const;
+
+            /**
+             * @brief Get the commands recorded since the last begin().
+             *
+             * @return The command list, replayed and kept until the next begin().
+             */
+            const SFUI::RenderCommandList& getCommandList() const;
+
+        private:
+            /**
+             * @brief Mesh appended to a retained draw call, with the version it had.
+             */
+            struct MeshSource {
+                const SFUI::Mesh* mesh;
+                SFUI::Size version;
+                SFUI::Vector2f offset;
+                SFUI::Optional<SFUI::FloatRect> clip;
+                bool operator==(const MeshSource&) const = default;
+            };
+
+            /**
+             * @brief Draw call whose merged geometry is kept in a vertex buffer between frames.
+             */
+            struct RetainedSegment {
+                SFUI::VertexBuffer vertexBuffer = SFUI::VertexBuffer(SFUI::PrimitiveType::Triangles, SFUI::VertexBuffer::Usage::Static);
+                SFUI::Vector<SFUI::RenderBatch::MeshSource> meshSources;
+                SFUI::Size vertexCount = 0;
+                SFUI::Size consecutiveUploads = 0;
+            };
+
+        private:
+            /**
+             * @brief Backend the current frame is replayed on.
+             */
+            SFUI::RenderBackend* backend = nullptr;
+
+            /**
+             * @brief Commands recorded in the current frame, holding the vertices of the pending draw call.
+             */
+            SFUI::RenderCommandList commandList;
+
+            /**
+             * @brief First vertex of the pending draw call in the vertex store of the command list.
+             */
+            SFUI::Size pendingFirstVertex = 0;
+
+            /**
+             * @brief Whether geometry is merged across vertex arrays.
+             */
+            SFUI::Bool batching = true;
+
+            /**
+             * @brief Whether batched geometry is retained on the GPU between frames.
+             */
+            SFUI::Bool retained = false;
+
+            /**
+             * @brief Whether the frame being recorded is retained, which needs a backend with an OpenGL context.
+             */
+            SFUI::Bool retaining = false;
+
+            /**
+             * @brief Whether geometry is clipped on the CPU instead of with the scissor box.
+             */
+            SFUI::Bool vertexClipping = false;
+
+            /**
+             * @brief Staging area of the uploads in retained mode.
+             */
+            SFUI::VertexArray vertices;
+
+            /**
+             * @brief Glyph texture of the pending draw call, or nullptr if it is untextured geometry.
+             */
+            const SFUI::Texture* textTexture = nullptr;
+
+            /**
+             * @brief Meshes of the pending draw call in retained mode.
+             */
+            SFUI::Vector<SFUI::RenderBatch::MeshSource> pendingMeshSources;
+
+            /**
+             * @brief Retained draw calls, in the order they were issued in the previous frame.
+             *
+             * They are allocated separately, as the recorded commands reference their vertex buffers.
+             */
+            SFUI::Vector<SFUI::UniquePointer<SFUI::RenderBatch::RetainedSegment>> retainedSegments;
+
+            /**
+             * @brief Number of retained draw calls issued in the current frame.
+             */
+            SFUI::Size retainedSegmentCount = 0;
+
+            /**
+             * @brief Clip rectangle of the pending geometry.
+             */
+            SFUI::Optional<SFUI::FloatRect> verticesClip;
+
+            /**
+             * @brief Clip rectangles pushed in the current frame.
+             */
+            SFUI::ClipStack clipStack;
+
+            /**
+             * @brief Statistics counted since the last begin().
+             */
+            SFUI::RenderBatch::FrameStatistics frameStatistics;
+
+        private:
+            /**
+             * @brief Check if geometry is waiting to be drawn.
+             *
+             * @return True if a draw call is pending, false otherwise.
+             */
+            SFUI::Bool hasPendingGeometry() const;
+
+            /**
+             * @brief Check if glyph quads are waiting to be drawn.
+             *
+             * @return True if a text draw call is pending, false otherwise.
+             */
+            SFUI::Bool hasPendingText() const;
+
+            /**
+             * @brief Record the pending glyph quads without a clip, since they are already clipped.
+             */
+            SFUI::Void flushText();
+
+            /**
+             * @brief Append the quad of a glyph, clipped to a rectangle.
+             *
+             * @param transform Transform of the text.
+             * @param position Position of the glyph's origin in the text.
+             * @param glyph Glyph to append.
+             * @param color Fill color of the text.
+             * @param clip Clip rectangle, or an empty optional if unclipped.
+             */
+            SFUI::Void appendGlyphQuad(const SFUI::Transform& transform, const SFUI::Vector2f& position, const SFUI::Glyph& glyph, const SFUI::Color& color, const SFUI::Optional<SFUI::FloatRect>& clip);
+
+            /**
+             * @brief Record the pending geometry with its clip rectangle.
+             */
+            SFUI::Void flush();
+
+            /**
+             * @brief Record the pending meshes as drawn from a retained vertex buffer, uploading them only if they changed.
+             */
+            SFUI::Void flushRetained();
+    };
+}
@@ -0,0 +1,168 @@
+/**
+ * @file RenderCommandList.hpp
+ * @brief Defines the RenderCommandList class recording the draw commands of the UI.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for RenderCommandList, the
+ * ordered list of draw commands recorded by a render batch during a frame,
+ * which owns their vertices and is replayed on a render backend.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include "RenderBackend.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Ordered draw commands of a frame and the vertices they draw.
+     *
+     * Geometry and text spans reference ranges of a single vertex store, and sprites
+     * are copied, so a list can be replayed after the drawables that recorded it are
+     * gone. Texts drawn on their own and other drawables are referenced, and must
+     * outlive the replay. Clip rectangles are recorded already intersected, and only
+     * when they change, so each clip command is a state change of the backend.
+     */
+    class RenderCommandList {
+
+        public:
+            /**
+             * @brief Kind of a draw command.
+             */
+            enum class CommandType {
+                Clip,
+                Geometry,
+                RetainedGeometry,
+                Text,
+                Sprite,
+                Drawable
+            };
+
+            /**
+             * @brief Draw command, whose used fields depend on its type.
+             */
+            struct Command {
+                SFUI::RenderCommandList::CommandType type;
+                SFUI::Optional<SFUI::FloatRect> clip;
+                SFUI::Size firstVertex = 0;
+                SFUI::Size vertexCount = 0;
+                const SFUI::Texture* texture = nullptr;
+                const SFUI::VertexBuffer* vertexBuffer = nullptr;
+                const SFUI::Drawable* drawable = nullptr;
+                SFUI::Size spriteIndex = 0;
+                SFUI::RenderStates renderStates;
+            };
+
+        public:
+            /**
+             * @brief Construct an empty command list.
+             */
+            RenderCommandList();
+
+            /**
+             * @brief Remove all commands and vertices, keeping the allocated memory.
+             */
+            SFUI::Void clear();
+
+            /**
+             * @brief Get the vertex store the geometry and text spans are appended to.
+             *
+             * @return Triangle vertices in render target coordinates.
+             */
+            SFUI::VertexArray& getVertices();
+
+            /**
+             * @brief Get the number of vertices in the vertex store.
+             *
+             * @return The vertex count.
+             */
+            SFUI::Size getVertexCount() const;
+
+            /**
+             * @brief Record a change of the clip rectangle, unless it is already the current one.
+             *
+             * @param clipRect Clip rectangle in render target coordinates, or an empty optional to disable clipping.
+             */
+            SFUI::Void setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect);
+
+            /**
+             * @brief Record untextured triangles, from a vertex of the store to its end.
+             *
+             * @param firstVertex First vertex of the span in the vertex store.
+             */
+            SFUI::Void addGeometry(SFUI::Size firstVertex);
+
+            /**
+             * @brief Record triangles kept in a vertex buffer.
+             *
+             * @param vertexBuffer Vertex buffer holding the triangles, which must outlive the replay.
+             * @param vertexCount Number of vertices drawn from the start of the buffer.
+             */
+            SFUI::Void addRetainedGeometry(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount);
+
+            /**
+             * @brief Record glyph quads, from a vertex of the store to its end.
+             *
+             * @param firstVertex First vertex of the span in the vertex store.
+             * @param texture Glyph texture of the quads.
+             */
+            SFUI::Void addText(SFUI::Size firstVertex, const SFUI::Texture* texture);
+
+            /**
+             * @brief Record a copy of a sprite.
+             *
+             * @param sprite Sprite to draw.
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void addSprite(const SFUI::Sprite& sprite, const SFUI::RenderStates& renderStates);
+
+            /**
+             * @brief Record a drawable by reference.
+             *
+             * @param drawable Drawable to draw, which must outlive the replay.
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void addDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates);
+
+            /**
+             * @brief Get the recorded commands.
+             *
+             * @return Commands in drawing order.
+             */
+            const SFUI::Vector<SFUI::RenderCommandList::Command>& getCommands() const;
+
+            /**
+             * @brief Replay the commands in order on a render backend.
+             *
+             * @param backend Backend receiving the commands.
+             */
+            SFUI::Void replay(SFUI::RenderBackend& backend) const;
+
+        private:
+            /**
+             * @brief Recorded commands in drawing order.
+             */
+            SFUI::Vector<SFUI::RenderCommandList::Command> commands;
+
+            /**
+             * @brief Vertices of the geometry and text spans.
+             */
+            SFUI::VertexArray vertices;
+
+            /**
+             * @brief Copies of the recorded sprites.
+             */
+            SFUI::Vector<SFUI::Sprite> sprites;
+
+            /**
+             * @brief Clip rectangle of the following commands, which starts unclipped.
+             */
+            SFUI::Optional<SFUI::FloatRect> clip;
+    };
+}
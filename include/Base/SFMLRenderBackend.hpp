@@ -0,0 +1,100 @@
+/**
+ * @file SFMLRenderBackend.hpp
+ * @brief Defines the SFMLRenderBackend class drawing the draw commands of the UI on a render target.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the class definition for SFMLRenderBackend, the
+ * render backend drawing replayed draw commands on an SFML render target,
+ * clipped with the scissor of the render target's view.
+ */
+
+
+#pragma once
+#include "Types/base.hpp"
+#include "Types/render.hpp"
+#include "Types/vector.hpp"
+#include "ClipStack.hpp"
+#include "RenderBackend.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @brief Render backend drawing on an SFML render target.
+     *
+     * The render target is activated when a replay begins, so command lists recorded
+     * while other targets were drawn on are replayed in the right OpenGL context.
+     */
+    class SFMLRenderBackend : public SFUI::RenderBackend {
+
+        public:
+            /**
+             * @brief Construct a backend drawing on a render target.
+             *
+             * @param drawTarget Target to draw on.
+             */
+            SFMLRenderBackend(SFUI::RenderTarget& drawTarget);
+
+            /**
+             * @brief Activate the render target and remember its view.
+             */
+            SFUI::Void begin() override;
+
+            /**
+             * @brief Restore the view the render target had when the replay began.
+             */
+            SFUI::Void end() override;
+
+            /**
+             * @brief Set the scissor of the render target's view.
+             *
+             * @param clipRect Clip rectangle in render target coordinates, or an empty optional to disable clipping.
+             */
+            SFUI::Void setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) override;
+
+            /**
+             * @brief Draw triangles from memory.
+             *
+             * @param vertices First vertex of the triangles.
+             * @param vertexCount Number of vertices.
+             * @param texture Texture of the triangles, or nullptr if untextured.
+             */
+            SFUI::Void drawVertices(const SFUI::Vertex* vertices, SFUI::Size vertexCount, const SFUI::Texture* texture) override;
+
+            /**
+             * @brief Draw triangles from a vertex buffer.
+             *
+             * @param vertexBuffer Vertex buffer holding the triangles.
+             * @param vertexCount Number of vertices drawn from the start of the buffer.
+             */
+            SFUI::Void drawVertexBuffer(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) override;
+
+            /**
+             * @brief Draw a drawable, such as a sprite or a text.
+             *
+             * @param drawable Drawable to draw.
+             * @param renderStates Render states to draw with.
+             */
+            SFUI::Void drawDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) override;
+
+            /**
+             * @brief Check if the backend draws through an OpenGL context.
+             *
+             * @return true, since the render target owns one.
+             */
+            SFUI::Bool hasGraphicsContext() const override;
+
+        private:
+            /**
+             * @brief Render target drawn on.
+             */
+            SFUI::RenderTarget& drawTarget;
+
+            /**
+             * @brief View of the render target when the replay began, without the clips set since.
+             */
+            SFUI::View baseView;
+    };
+}
@@ -16,7 +16,12 @@
 #include "Types/render.hpp"
 #include "Types/vector.hpp"
 #include "Component.hpp"
-#include <deque>
+#include "HitTestGrid.hpp"
+#include "RenderBatch.hpp"
+#include "LayerCache.hpp"
+#include "QualityController.hpp"
+#include "SFMLRenderBackend.hpp"
+#include <typeinfo>
 
 
 namespace SFUI {
@@ -48,42 +53,74 @@ namespace SFUI {
              */
             SFUI::Void setRootComponent(SFUI::UniquePointer<SFUI::Component> rootComponent);
 
+            /**
+             * @brief Cacheable reference to a component of the tree, resolved through the component index.
+             *
+             * A handle stays valid across frames until the component it refers to is removed from the tree.
+             */
+            template<typename T>
+            struct Handle {
+                SFUI::Size slot = 0;
+                SFUI::Size generation = 0;
+            };
+
             /**
              * @brief Get one of the UI component's in the tree by its component ID.
              *
+             * The lookup goes through a hash index of the component IDs, and the stored dynamic type
+             * of the component avoids a dynamic_cast when it is exactly T.
+             *
              * @param componentID The unique identifier of the component to find.
              *
-             * @return A raw pointer to the Component.
+             * @return A raw pointer to the Component, or nullptr if not found or not a T.
              */
             template<typename T>
-            T* getComponent(const std::string componentID) {
+            T* getComponent(const SFUI::String& componentID) {
                 static_assert(std::is_base_of<SFUI::Component, T>::value, "T must derive from SFUI::Component (Label, Button, etc.)");
 
-                if (!rootComponent) return nullptr;
-
-                // Breadth-First Traversal Algorithm for UI Finding the Component //
-                std::deque<SFUI::Component*> childrenQueue;
-                childrenQueue.push_back(rootComponent.get());
-
-                while (!childrenQueue.empty()) {
-                    SFUI::Component* currentChild = childrenQueue.front();
-                    childrenQueue.pop_front();
+                const SFUI::UIRoot::ComponentSlot* componentSlot = findComponentSlot(componentID);
+                if (!componentSlot) return nullptr;
+                return castComponent<T>(*componentSlot);
+            }
 
-                    if (currentChild->componentID == componentID) {
-                        return dynamic_cast<T*>(currentChild);
-                    }
+            /**
+             * @brief Get a cacheable handle to one of the UI components in the tree by its component ID.
+             *
+             * @param componentID The unique identifier of the component to find.
+             *
+             * @return A handle to the component, or an empty optional if not found or not a T.
+             */
+            template<typename T>
+            SFUI::Optional<SFUI::UIRoot::Handle<T>> getComponentHandle(const SFUI::String& componentID) {
+                static_assert(std::is_base_of<SFUI::Component, T>::value, "T must derive from SFUI::Component (Label, Button, etc.)");
 
-                    const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& currentChildChildren = currentChild->getChildren();
-                    for (const auto& currentChildChild : currentChildChildren) {
-                        childrenQueue.push_back(currentChildChild.get());
-                    }
-                }
+                const SFUI::UIRoot::ComponentSlot* componentSlot = findComponentSlot(componentID);
+                if (!componentSlot || !castComponent<T>(*componentSlot)) return std::nullopt;
+                return SFUI::UIRoot::Handle<T>{static_cast<SFUI::Size>(componentSlot - componentSlots.data()), componentSlot->generation};
+            }
 
-                return nullptr;
+            /**
+             * @brief Resolve a handle to the component it refers to.
+             *
+             * @param handle Handle obtained from getComponentHandle().
+             *
+             * @return A raw pointer to the Component, or nullptr if it was removed from the tree.
+             */
+            template<typename T>
+            T* getComponent(const SFUI::UIRoot::Handle<T>& handle) {
+                if (!rootComponent) return nullptr;
+                refreshTraversalOrder();
+                if (handle.slot >= componentSlots.size()) return nullptr;
+                const SFUI::UIRoot::ComponentSlot& componentSlot = componentSlots[handle.slot];
+                if (componentSlot.generation != handle.generation || !componentSlot.component) return nullptr;
+                return static_cast<T*>(componentSlot.component);
             }
 
             /**
-             * @brief Handle an input event by propagating it to the root component.
+             * @brief Handle an input event by propagating it to the components of the UI.
+             *
+             * Mouse events are only routed to the components under the cursor and those engaged with the mouse,
+             * and keyboard and text events only to the engaged components subscribed to them.
              *
              * @param event Event to process.
              */
@@ -99,33 +136,605 @@ namespace SFUI {
             /**
              * @brief Draw the UI to the render target.
              *
+             * In compositing mode, only the damaged regions of the UI tree are redrawn into the composite
+             * texture, and the composite texture is drawn to the render target as a single quad.
+             *
              * @param drawTarget Target to draw on.
              * @param window Window reference.
              */
             SFUI::Void draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the UI tree and its overlay pass to a render backend.
+             *
+             * Used with a recording backend, it measures the draw calls, vertices and state changes of the UI
+             * without a window or an OpenGL context. Cached layers and compositing need render textures, so
+             * the tree is drawn directly, skipping the occluded components if occlusion culling is enabled.
+             *
+             * @param backend Backend to draw to.
+             */
+            SFUI::Void draw(SFUI::RenderBackend& backend);
+
+            /**
+             * @brief Enable or disable drawing the UI tree through a composite texture redrawn only when the UI changes.
+             *
+             * Suits UIs drawn over a scene redrawn every frame while the UI itself rarely changes.
+             * The overlay pass is still drawn directly every frame.
+             *
+             * @param compositing Whether compositing is enabled, which it is not by default.
+             */
+            SFUI::Void setCompositing(SFUI::Bool compositing);
+
+            /**
+             * @brief Check if the last draw changed the drawn UI tree.
+             *
+             * @return true if the composite texture was redrawn, or compositing is disabled, false otherwise.
+             */
+            SFUI::Bool hasCompositeChanged() const;
+
+            /**
+             * @brief Get the regions of the render target damaged by changed components since the draw before the last update.
+             *
+             * A changed component damages both the area it was drawn in and the area it is now drawn in,
+             * clipped by its ancestors. In compositing mode, the next draw only redraws these regions of
+             * the composite texture. The damage gathered by the updates before a draw is kept after the
+             * draw, and cleared by the next update.
+             *
+             * @return Disjoint damaged regions, or the whole render target if the tree structure or its size changed.
+             */
+            SFUI::Vector<SFUI::FloatRect> getDamageRects() const;
+
+            /**
+             * @brief Get the composite texture holding the UI tree, with colors premultiplied by alpha.
+             *
+             * @return The composite texture, or nullptr if compositing is disabled or it was not drawn yet.
+             */
+            const SFUI::Texture* getCompositeTexture() const;
+
+            /**
+             * @brief Enable or disable merging the geometry of the UI tree into as few draw calls as possible.
+             *
+             * @param renderBatching Whether render batching is enabled, which it is by default.
+             */
+            SFUI::Void setRenderBatching(SFUI::Bool renderBatching);
+
+            /**
+             * @brief Enable or disable keeping the geometry of the UI tree in GPU vertex buffers between frames.
+             *
+             * When enabled, each draw call keeps its merged geometry in a vertex buffer that is only uploaded
+             * again when one of its components' geometry changes, so static parts of the UI cost no upload.
+             *
+             * @param retainedGeometry Whether retained geometry is enabled, which it is not by default.
+             */
+            SFUI::Void setRetainedGeometry(SFUI::Bool retainedGeometry);
+
+            /**
+             * @brief Enable or disable clipping the geometry and text of the UI on the CPU instead of with the scissor box.
+             *
+             * Removes the scissor changes between components, so a UI without sprites is merged into as few
+             * draw calls as its glyph textures allow, at the cost of cutting the triangles crossing a clip edge.
+             *
+             * @param vertexClipping Whether vertex clipping is enabled, which it is not by default.
+             */
+            SFUI::Void setVertexClipping(SFUI::Bool vertexClipping);
+
+            /**
+             * @brief Enable or disable skipping components hidden beneath opaque components drawn after them.
+             *
+             * A component is skipped when its visible draw bounds lie inside the opaque rectangle of a single
+             * later drawn component, such as a sibling stacked on top of it or a descendant filling it. Its
+             * children are still drawn unless they are hidden too. Occlusion is recomputed when the UI changes.
+             *
+             * @param occlusionCulling Whether occlusion culling is enabled, which it is not by default.
+             */
+            SFUI::Void setOcclusionCulling(SFUI::Bool occlusionCulling);
+
+            /**
+             * @brief Set the quality of the rounded corners of the UI, trading arc fidelity for vertices.
+             *
+             * Arcs are tessellated within a quarter-pixel error at quality 1, at the scale of the view
+             * the UI was last drawn with. The geometry of every component is rebuilt on the next update.
+             *
+             * @param arcQuality Quality factor dividing the tolerated error, 1 by default.
+             */
+            SFUI::Void setArcQuality(SFUI::Float arcQuality);
+
+            /**
+             * @brief Enable or disable building shadows as a single gradient ring mesh instead of stacked layers.
+             *
+             * A ring has a vertex count bounded by its corner resolution, whatever the shadow radius, while
+             * stacked layers add five rects and four arcs per unit of radius. The geometry of every component
+             * is rebuilt on the next update.
+             *
+             * @param shadowRings Whether shadows are gradient rings, which they are by default.
+             */
+            SFUI::Void setShadowRings(SFUI::Bool shadowRings);
+
+            /**
+             * @brief Enable or disable adapting the rendering quality to the frame budget.
+             *
+             * The CPU cost of each update and draw is measured. While frames are over budget, the quality
+             * is reduced one level at a time: the tree is composited, then arcs are coarsened, then shadows
+             * are narrowed, then dropped. Levels are restored one at a time once frames are well under budget again.
+             * Disabling it restores full quality.
+             *
+             * @param adaptiveQuality Whether adaptive quality is enabled, which it is not by default.
+             */
+            SFUI::Void setAdaptiveQuality(SFUI::Bool adaptiveQuality);
+
+            /**
+             * @brief Set the budget of an update and draw for adaptive quality.
+             *
+             * @param frameBudget Largest frame cost allowed, 16.667 ms by default.
+             */
+            SFUI::Void setFrameBudget(SFUI::Time frameBudget);
+
+            /**
+             * @brief Set the callback triggered on each adaptive quality transition.
+             *
+             * @param onQualityChange Callback given the previous and new levels, the smoothed frame cost and the budget.
+             */
+            SFUI::Void setOnQualityChange(SFUI::QualityController::TransitionCallback onQualityChange);
+
+            /**
+             * @brief Get the current adaptive quality level.
+             *
+             * @return Quality level, always full when adaptive quality is disabled.
+             */
+            SFUI::QualityController::Level getQualityLevel() const;
+
+            /**
+             * @brief Get the drawing statistics of the UI tree in the last drawn frame.
+             *
+             * The requested draw calls are the ones the components would issue on their own, the issued
+             * draw calls are the ones actually made after batching, and the culled components are the
+             * ones skipped for lying outside of the render target or their ancestors' clip. The uploaded
+             * vertices are the ones sent to the GPU. The occluded components are the ones skipped for being
+             * hidden beneath opaque components. The drawn area is the unclipped area of the drawn geometry,
+             * and divided by the render target area it estimates the overdraw. The overlay pass is not
+             * counted. In compositing mode, they are the statistics of the last redraw of the composite texture.
+             *
+             * @return Draw call counts, culled and occluded component counts, uploaded vertex count and drawn area.
+             */
+            SFUI::RenderBatch::FrameStatistics getFrameStatistics() const;
+
+            /**
+             * @brief Get the number of distinct meshes shared between the components of the UI.
+             *
+             * @return Number of shared meshes still used by a component.
+             */
+            SFUI::Size getSharedMeshCount() const;
+
+            /**
+             * @brief Set the memory budget of the texture layers of components cached as layers.
+             *
+             * Once over budget, the least recently drawn layers are freed at the end of a frame.
+             *
+             * @param budgetBytes Budget in bytes, 64 MiB by default.
+             */
+            SFUI::Void setLayerBudget(SFUI::Size budgetBytes);
+
+            /**
+             * @brief Get the memory statistics of the texture layers of components cached as layers.
+             *
+             * @return Layer count and memory, budget, and the layers redrawn and evicted in the last drawn frame.
+             */
+            SFUI::LayerCache::Statistics getLayerStatistics() const;
+
         private:
+            /**
+             * @brief Component index entry of a component ID.
+             */
+            struct ComponentSlot {
+                SFUI::Component* component = nullptr;
+                const std::type_info* type = nullptr;
+                SFUI::Size generation = 0;
+                SFUI::Size indexedBuild = 0;
+            };
+
+        private:
+            /**
+             * @brief Blend mode of cached layers and the composite texture, whose colors are premultiplied by alpha blending into a transparent texture.
+             */
+            static const SFUI::BlendMode LAYER_BLEND_MODE;
+
+            /**
+             * @brief Blend mode overwriting the damaged regions of the composite texture with transparency.
+             */
+            static const SFUI::BlendMode DAMAGE_CLEAR_BLEND_MODE;
+
+            /**
+             * @brief Maximum number of damaged regions, beyond which they are merged into their bounding box.
+             */
+            static constexpr SFUI::Size MAX_DAMAGE_RECTS = 8;
+
+            /**
+             * @brief Maximum number of opaque rectangles tested by the occlusion pass, the largest ones being kept.
+             */
+            static constexpr SFUI::Size MAX_OCCLUDERS = 16;
+
+            /**
+             * @brief Factor applied to the arc quality from the coarse arcs quality level on.
+             */
+            static constexpr SFUI::Float COARSE_ARC_QUALITY = 0.25f;
+
+            /**
+             * @brief Share of the shadow radius drawn at the reduced shadows quality level.
+             */
+            static constexpr SFUI::Float REDUCED_SHADOW_SCALE = 0.5f;
+
             /**
              * @brief Unique pointer to the root component of the UI.
              */
             SFUI::UniquePointer<SFUI::Component> rootComponent;
 
+            /**
+             * @brief Render target size of the previous update, used to detect resizes.
+             */
+            SFUI::Vector2u previousRenderTargetSize;
+
+            /**
+             * @brief Number of screen pixels per unit of the view the UI was last drawn with.
+             */
+            SFUI::Float arcScale = 1.0f;
+
+            /**
+             * @brief Whether compositing was requested through setCompositing(), regardless of the quality level.
+             */
+            SFUI::Bool compositingRequested = false;
+
+            /**
+             * @brief Arc quality requested through setArcQuality(), before the quality level reduces it.
+             */
+            SFUI::Float arcQuality = 1.0f;
+
+            /**
+             * @brief Whether shadows are built as gradient rings rather than stacked layers.
+             */
+            SFUI::Bool shadowRings = true;
+
+            /**
+             * @brief Whether the rendering quality adapts to the frame budget.
+             */
+            SFUI::Bool adaptiveQuality = false;
+
+            /**
+             * @brief Controller choosing the quality level from the frame costs.
+             */
+            SFUI::QualityController qualityController;
+
+            /**
+             * @brief Callback triggered on each adaptive quality transition.
+             */
+            SFUI::QualityController::TransitionCallback onQualityChange;
+
+            /**
+             * @brief CPU cost of the last update, added to the draw cost to get the frame cost.
+             */
+            SFUI::Time updateCost;
+
+            /**
+             * @brief Components of the UI tree in breadth-first order, rebuilt only when the tree structure changes.
+             */
+            SFUI::Vector<SFUI::Component*> traversalOrder;
+
+            /**
+             * @brief Slot of each component ID in the component index.
+             */
+            SFUI::UnorderedMap<SFUI::String, SFUI::Size> componentSlotIndices;
+
+            /**
+             * @brief Component index slots, kept for every ID ever indexed so handles stay resolvable.
+             */
+            SFUI::Vector<SFUI::UIRoot::ComponentSlot> componentSlots;
+
+            /**
+             * @brief Number of times the component index was rebuilt, used to find slots of removed components.
+             */
+            SFUI::Size componentIndexBuild = 0;
+
+            /**
+             * @brief Spatial index of the clipped hit bounds of every component, used to route mouse events.
+             */
+            SFUI::HitTestGrid hitTestGrid;
+
+            /**
+             * @brief Whether the hit-test grid indexes the current tree, false until it is rebuilt by an update.
+             */
+            SFUI::Bool hitTestGridValid = false;
+
+            /**
+             * @brief Components that must keep receiving mouse events while the cursor is outside of them.
+             */
+            SFUI::Vector<SFUI::Component*> mouseEngagedComponents;
+
+            /**
+             * @brief Components that must receive keyboard and text events, such as focused ones.
+             */
+            SFUI::Vector<SFUI::Component*> keyboardEngagedComponents;
+
+            /**
+             * @brief Components subscribed to events other than mouse, keyboard, and text events.
+             */
+            SFUI::Vector<SFUI::Component*> otherEventSubscribers;
+
+            /**
+             * @brief Components an event is routed to, reused between events.
+             */
+            SFUI::Vector<SFUI::Component*> eventTargets;
+
+            /**
+             * @brief Batch the UI tree is drawn through.
+             */
+            SFUI::RenderBatch renderBatch;
+
+            /**
+             * @brief Batch the overlay pass is drawn through.
+             */
+            SFUI::RenderBatch overlayBatch;
+
+            /**
+             * @brief Whether the geometry of the UI tree is merged across components.
+             */
+            SFUI::Bool renderBatching = true;
+
+            /**
+             * @brief Whether components hidden beneath opaque components drawn after them are skipped.
+             */
+            SFUI::Bool occlusionCulling = false;
+
+            /**
+             * @brief Whether the occluded components must be found again on the next update.
+             */
+            SFUI::Bool occlusionDirty = true;
+
+            /**
+             * @brief Opaque rectangles of the components drawn after the one tested by the occlusion pass.
+             */
+            SFUI::Vector<SFUI::FloatRect> occluders;
+
+            /**
+             * @brief Texture layers of the components cached as layers.
+             */
+            SFUI::LayerCache layerCache;
+
+            /**
+             * @brief Meshes shared between the components of the UI.
+             */
+            SFUI::MeshRegistry meshRegistry;
+
+            /**
+             * @brief Settings of the UI given to each component it updates.
+             */
+            SFUI::Component::UpdateContext updateContext;
+
+            /**
+             * @brief Batch the subtree being drawn into a layer is drawn through.
+             */
+            SFUI::RenderBatch layerBatch;
+
+            /**
+             * @brief Composite texture the UI tree is drawn into in compositing mode, null otherwise.
+             */
+            SFUI::UniquePointer<SFUI::RenderTexture> compositeTexture;
+
+            /**
+             * @brief Whether the whole render target is damaged since the last draw.
+             */
+            SFUI::Bool fullDamage = true;
+
+            /**
+             * @brief Disjoint regions damaged since the draw before the last update.
+             */
+            SFUI::Vector<SFUI::FloatRect> damageRects;
+
+            /**
+             * @brief Whether the damage regions were drawn, and are cleared by the next update.
+             */
+            SFUI::Bool damageDrawn = false;
+
+            /**
+             * @brief Regions of the render target drawn by a draw without the composite texture, kept to reuse their storage.
+             */
+            SFUI::Vector<SFUI::FloatRect> drawRegions;
+
+            /**
+             * @brief Shapes clearing the damaged regions of the composite texture, kept to reuse their storage.
+             */
+            SFUI::Vector<SFUI::RectangleShape> clearShapes;
+
+            /**
+             * @brief Whether the last draw changed the drawn UI tree.
+             */
+            SFUI::Bool compositeChanged = true;
+
         private:
             /**
-             * @brief Recursively draw a component and its children.
+             * @brief Flatten the UI tree into its breadth-first traversal order if its structure changed.
+             */
+            SFUI::Void refreshTraversalOrder();
+
+            /**
+             * @brief Rebuild the component index from the traversal order.
+             */
+            SFUI::Void rebuildComponentIndex();
+
+            /**
+             * @brief Find the component index slot of a component ID.
+             *
+             * @param componentID Component ID to look up.
+             *
+             * @return Pointer to the slot, or nullptr if no component of the tree has the ID.
+             */
+            const SFUI::UIRoot::ComponentSlot* findComponentSlot(const SFUI::String& componentID);
+
+            /**
+             * @brief Cast the component of an index slot to a component type.
+             *
+             * @param componentSlot Slot holding the component.
+             *
+             * @return A raw pointer to the Component, or nullptr if it is not a T.
+             */
+            template<typename T>
+            static T* castComponent(const SFUI::UIRoot::ComponentSlot& componentSlot) {
+                if (*componentSlot.type == typeid(T)) return static_cast<T*>(componentSlot.component);
+                return dynamic_cast<T*>(componentSlot.component);
+            }
+
+            /**
+             * @brief Get the cursor position carried by a mouse event.
+             *
+             * @param event Event to inspect.
+             *
+             * @return Cursor position, or an empty optional if the event is not a positioned mouse event.
+             */
+            static SFUI::Optional<SFUI::Vector2f> getMouseEventPosition(const SFUI::Event& event);
+
+            /**
+             * @brief Route a mouse event to the components under the cursor and the engaged components.
+             *
+             * @param event Event to process.
+             * @param mousePosition Cursor position carried by the event.
+             */
+            SFUI::Void routeMouseEvent(const SFUI::Event& event, const SFUI::Vector2f& mousePosition);
+
+            /**
+             * @brief Route a keyboard or text event to the engaged components subscribed to it.
+             *
+             * @param event Event to process.
+             * @param isTextEvent Whether the event is a text event rather than a keyboard event.
+             */
+            SFUI::Void routeKeyboardEvent(const SFUI::Event& event, SFUI::Bool isTextEvent);
+
+            /**
+             * @brief Check if a component is subscribed to the type of an event.
+             *
+             * @param subscriptions Event subscriptions of the component.
+             * @param event Event to check.
+             *
+             * @return true if the component consumes the event, false otherwise.
+             */
+            static SFUI::Bool isSubscribed(const SFUI::Component::EventSubscriptions& subscriptions, const SFUI::Event& event);
+
+            /**
+             * @brief Add or remove a component from the engaged component lists according to its current state.
+             *
+             * @param component Component to check.
+             */
+            SFUI::Void refreshEngagement(SFUI::Component* component);
+
+            /**
+             * @brief Add or remove a component from an engaged component list.
+             *
+             * @param engagedComponents Engaged component list to modify.
+             * @param component Component to add or remove.
+             * @param engaged Whether the component is engaged.
+             */
+            static SFUI::Void setEngaged(SFUI::Vector<SFUI::Component*>& engagedComponents, SFUI::Component* component, SFUI::Bool engaged);
+
+            /**
+             * @brief Index a component in the hit-test grid using its parent's clip.
+             *
+             * @param component Component to index.
+             * @param parentClip Clip rectangle applied to the component by its ancestors.
+             * @param order Traversal order of the component.
+             */
+            SFUI::Void indexComponent(SFUI::Component* component, const SFUI::FloatRect& parentClip, SFUI::Size order);
+
+            /**
+             * @brief Find the components of a subtree hidden beneath opaque components drawn after them.
+             *
+             * @param component Root of the subtree.
+             */
+            SFUI::Void findOccludedComponents(SFUI::Component* component);
+
+            /**
+             * @brief Add the clipped draw bounds of a changed component to the damaged regions.
+             *
+             * @param drawBounds Draw bounds of the component.
+             * @param clip Clip of the component's ancestors when drawn with these bounds.
+             */
+            SFUI::Void addDamage(const SFUI::FloatRect& drawBounds, const SFUI::FloatRect& clip);
+
+            /**
+             * @brief Draw regions of the UI tree, without the overlay pass, to a render target.
              *
-             * @param component Component to draw.
              * @param drawTarget Target to draw on.
-             * @param window Window reference.
+             * @param regions Regions of the render target to draw.
+             * @param clearRegions Whether the regions are cleared to transparency before drawing.
              */
-            SFUI::Void drawRecursive(const SFUI::UniquePointer<SFUI::Component>& component, SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
+            SFUI::Void drawTree(SFUI::RenderTarget& drawTarget, const SFUI::Vector<SFUI::FloatRect>& regions, SFUI::Bool clearRegions);
 
             /**
-             * @brief Draw the overlay components of the UI to the render target.
+             * @brief Draw the UI tree through the composite texture, redrawing its damaged regions first.
              *
              * @param drawTarget Target to draw on.
-             * @param window Window reference.
+             *
+             * @return true if drawn, false if the composite texture cannot be used.
+             */
+            SFUI::Bool drawComposited(SFUI::RenderTarget& drawTarget);
+
+            /**
+             * @brief Get the area of the UI shown by the current view of a render target.
+             *
+             * @param drawTarget Target to draw on.
+             *
+             * @return Visible area, in the coordinates of the current view.
+             */
+            static SFUI::FloatRect getVisibleArea(const SFUI::RenderTarget& drawTarget);
+
+            /**
+             * @brief Flag the layers containing a changed component as outdated.
+             *
+             * @param component Component about to be updated.
+             */
+            SFUI::Void invalidateLayers(const SFUI::Component* component);
+
+            /**
+             * @brief Measure the cost of a frame for adaptive quality, applying and reporting any quality transition.
+             *
+             * @param frameCost CPU cost of the last update and draw.
+             */
+            SFUI::Void adaptQuality(SFUI::Time frameCost);
+
+            /**
+             * @brief Apply the compositing setting of the current quality level.
+             */
+            SFUI::Void applyQuality();
+
+            /**
+             * @brief Recursively draw a component and its children.
+             *
+             * @param renderBatch Batch to draw through.
+             * @param component Component to draw.
+             * @param layered Whether components cached as layers are drawn through their layer.
+             * @param skipOccluded Whether occluded components are skipped.
+             */
+            SFUI::Void drawRecursive(SFUI::RenderBatch& renderBatch, const SFUI::UniquePointer<SFUI::Component>& component, SFUI::Bool layered, SFUI::Bool skipOccluded);
+
+            /**
+             * @brief Draw a component and its children through their cached layer, redrawing it first if outdated.
+             *
+             * @param component Component cached as a layer.
+             *
+             * @return true if drawn through the layer, false if the component must be drawn directly.
+             */
+            SFUI::Bool drawLayer(const SFUI::UniquePointer<SFUI::Component>& component);
+
+            /**
+             * @brief Count the components of a subtree.
+             *
+             * @param component Root of the subtree.
+             *
+             * @return Number of components in the subtree, including its root.
+             */
+            static SFUI::Size countSubtree(const SFUI::Component* component);
+
+            /**
+             * @brief Draw the overlay components of the UI to a render backend.
+             *
+             * @param backend Backend to draw to.
              */
-            SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
+            SFUI::Void drawOverlay(SFUI::RenderBackend& backend);
     };
 }
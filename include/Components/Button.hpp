@@ -119,6 +119,34 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the overlay pass of the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawOverlayBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Check if the button must keep receiving mouse events while the cursor is outside of it.
+             *
+             * @return true if the button is hovered, pressed, focused, or showing its tool-tip, false otherwise.
+             */
+            SFUI::Bool isMouseEngaged() const override;
+
+            /**
+             * @brief Check if the button must receive keyboard and text events.
+             *
+             * @return true if the button is focused or showing its tool-tip, false otherwise.
+             */
+            SFUI::Bool isKeyboardEngaged() const override;
+
+            /**
+             * @brief Get the event types consumed by the button.
+             *
+             * @return Mouse and keyboard events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
         private:
             /**
              * @brief Time thresholds for double-click and tool-tip display.
@@ -196,6 +224,21 @@ namespace SFUI {
              */
             SFUI::Label toolTip;
 
+            /**
+             * @brief Last committed button style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Button::Style> committedStyle;
+
+            /**
+             * @brief Last committed button state props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Button::State> committedState;
+
+            /**
+             * @brief Compiled button style props, refreshed only when the style changes.
+             */
+            SFUI::CompiledProp::Style::Button compiledButtonStyle;
+
         private:
             /**
              * @brief Compute dynamically changing color style properties.
@@ -114,5 +114,12 @@ namespace SFUI {
              * @param window Window reference.
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
+
+            /**
+             * @brief Get the event types consumed by the container.
+             *
+             * @return No event types, as containers do not handle events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
     };
 }
@@ -116,6 +116,20 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Get the event types consumed by the graphic.
+             *
+             * @return No event types, as graphics do not handle events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
             /**
              * @brief Get the original size of the loaded texture.
              *
@@ -160,6 +174,11 @@ namespace SFUI {
              */
             SFUI::ComputedProp::Style::Graphic computedGraphicStyle;
 
+            /**
+             * @brief Last committed graphic style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Graphic::Style> committedStyle;
+
         private:
             /**
              * @brief Compute the graphic source based on load type and state.
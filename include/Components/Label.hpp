@@ -117,6 +117,20 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Get the event types consumed by the label.
+             *
+             * @return No event types, as labels do not handle events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
             /**
              * @brief Get text properties and metrics.
              *
@@ -159,6 +173,16 @@ namespace SFUI {
              */
             SFUI::Text textObject;
 
+            /**
+             * @brief Last committed label style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Label::Style> committedStyle;
+
+            /**
+             * @brief Resolved label text colors, refreshed only when the style changes.
+             */
+            SFUI::CompiledProp::Style::Label compiledLabelStyle;
+
         private:
 
             /**
@@ -117,6 +117,20 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Check if the scroll container must keep receiving mouse events while the cursor is outside of it.
+             *
+             * @return true if the scroll container is hovered, false otherwise.
+             */
+            SFUI::Bool isMouseEngaged() const override;
+
+            /**
+             * @brief Get the event types consumed by the scroll container.
+             *
+             * @return Mouse events only.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
         private:
             /**
              * @brief Whether the mouse is hovering over the scroll container.
@@ -148,6 +162,11 @@ namespace SFUI {
              */
             SFUI::ComputedProp::Style::ScrollContainer computedScrollContainerStyle;
 
+            /**
+             * @brief Last committed scroll container style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::ScrollContainer::Style> committedStyle;
+
         private:
             /**
              * @brief Compute the layout of the scroll container and its children's alignments.
@@ -124,6 +124,55 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Draw the overlay pass of the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawOverlayBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Check if the slider must keep receiving mouse events while the cursor is outside of it.
+             *
+             * @return true if the slider is hovered, pressed, sliding, or focused, false otherwise.
+             */
+            SFUI::Bool isMouseEngaged() const override;
+
+            /**
+             * @brief Check if the slider must receive keyboard and text events.
+             *
+             * @return true if the slider is focused, false otherwise.
+             */
+            SFUI::Bool isKeyboardEngaged() const override;
+
+            /**
+             * @brief Get the event types consumed by the slider.
+             *
+             * @return Mouse and keyboard events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
+            /**
+             * @brief Get the bounds used to index the slider for mouse event routing.
+             *
+             * @return Layout box of the slider extended by the bounds of its thumb.
+             */
+            SFUI::FloatRect getHitBounds() const override;
+
+            /**
+             * @brief Get the bounds of everything the slider draws in the UI tree pass.
+             *
+             * @return Draw bounds of the slider extended by the draw bounds of its tracks and thumb.
+             */
+            SFUI::FloatRect getDrawBounds() const override;
+
         private:
             /**
              * @brief Whether the mouse is hovering over the slider track.
@@ -205,6 +254,21 @@ namespace SFUI {
              */
             SFUI::ComputedProp::Style::Slider computedSliderStyle;
 
+            /**
+             * @brief Last committed slider style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Slider::Style> committedStyle;
+
+            /**
+             * @brief Last committed slider state props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Slider::State> committedState;
+
+            /**
+             * @brief Compiled slider style props, refreshed only when the style changes.
+             */
+            SFUI::CompiledProp::Style::Slider compiledSliderStyle;
+
         private:
             /**
              * @brief Compute the alignment of the track (horizontal/vertical).
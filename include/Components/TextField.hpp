@@ -124,6 +124,55 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Draw the overlay pass of the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawOverlayBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Get the bounds of everything the text field draws in the UI tree pass.
+             *
+             * @return Draw bounds of its background, input text and caret.
+             */
+            SFUI::FloatRect getDrawBounds() const override;
+
+            /**
+             * @brief Get a rectangle the text field draws fully opaque in the UI tree pass.
+             *
+             * @return Opaque rectangle of its background, or an empty optional if none.
+             */
+            SFUI::Optional<SFUI::FloatRect> getOpaqueBounds() const override;
+
+            /**
+             * @brief Check if the text field must keep receiving mouse events while the cursor is outside of it.
+             *
+             * @return true if the text field is focused or its background is engaged, false otherwise.
+             */
+            SFUI::Bool isMouseEngaged() const override;
+
+            /**
+             * @brief Check if the text field must receive keyboard and text events.
+             *
+             * @return true if the text field is focused or its background is engaged, false otherwise.
+             */
+            SFUI::Bool isKeyboardEngaged() const override;
+
+            /**
+             * @brief Get the event types consumed by the text field.
+             *
+             * @return Mouse, keyboard, and text events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
         private:
             /**
              * @brief Factor controlling the vertical offset when centering text.
@@ -221,6 +270,21 @@ namespace SFUI {
              */
             SFUI::ComputedProp::Style::TextField computedTextFieldStyle;
 
+            /**
+             * @brief Last committed text field style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::TextField::Style> committedStyle;
+
+            /**
+             * @brief Last committed text field state props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::TextField::State> committedState;
+
+            /**
+             * @brief Compiled text field style props, refreshed only when the style changes.
+             */
+            SFUI::CompiledProp::Style::TextField compiledTextFieldStyle;
+
         private:
             /**
              * @brief Compute the line mode (single/multi) and adjust related properties.
@@ -121,12 +121,71 @@ namespace SFUI {
              */
             SFUI::Void drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window);
 
+            /**
+             * @brief Draw the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Draw the overlay pass of the component through the render batch of its UI root.
+             *
+             * @param renderBatch Batch to draw through.
+             */
+            SFUI::Void drawOverlayBatched(SFUI::RenderBatch& renderBatch) override;
+
+            /**
+             * @brief Get the bounds of everything the toggle draws in the UI tree pass.
+             *
+             * @return Draw bounds of its switch button.
+             */
+            SFUI::FloatRect getDrawBounds() const override;
+
+            /**
+             * @brief Get a rectangle the toggle draws fully opaque in the UI tree pass.
+             *
+             * @return Opaque rectangle of its switch button, or an empty optional if none.
+             */
+            SFUI::Optional<SFUI::FloatRect> getOpaqueBounds() const override;
+
+            /**
+             * @brief Check if the toggle must keep receiving mouse events while the cursor is outside of it.
+             *
+             * @return true if the toggle is focused or its switch button is engaged, false otherwise.
+             */
+            SFUI::Bool isMouseEngaged() const override;
+
+            /**
+             * @brief Check if the toggle must receive keyboard and text events.
+             *
+             * @return true if the toggle is focused or its switch button is engaged, false otherwise.
+             */
+            SFUI::Bool isKeyboardEngaged() const override;
+
+            /**
+             * @brief Get the event types consumed by the toggle.
+             *
+             * @return Mouse and keyboard events.
+             */
+            SFUI::Component::EventSubscriptions getEventSubscriptions() const override;
+
         private:
             /**
              * @brief The main button representing the toggle switch.
              */
             SFUI::Button toggle;
 
+            /**
+             * @brief Last committed toggle style props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Toggle::Style> committedStyle;
+
+            /**
+             * @brief Last committed toggle state props, used to detect changes.
+             */
+            SFUI::Optional<SFUI::PropGroup::Toggle::State> committedState;
+
         private:
             /**
              * @brief Compute dynamic colors based on state and style.
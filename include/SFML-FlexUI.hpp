@@ -26,11 +26,13 @@
 #include "Types/propgroup.hpp"
 #include "Types/propset.hpp"
 #include "Types/computedprop.hpp"
+#include "Types/compiledprop.hpp"
 
 
 // Base //
 #include "Base/UIRoot.hpp"
 #include "Base/Component.hpp"
+#include "Base/RecordingRenderBackend.hpp"
 
 
 // Components //
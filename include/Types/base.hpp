@@ -58,8 +58,8 @@ namespace SFUI {
     template <typename T, std::size_t N>
     using Array = std::array<T, N>;
 
-    template <typename T, typename N>
-    using UnorderedMap = std::unordered_map<T, N>;
+    template <typename... T>
+    using UnorderedMap = std::unordered_map<T ...>;
 
     template <typename... T>
     using WeakPointer = std::weak_ptr<T ...>;
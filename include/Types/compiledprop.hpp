@@ -0,0 +1,174 @@
+/**
+ * @file compiledprop.hpp
+ * @brief Defines compiled properties for SFUI components.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the tagged numeric forms that raw property inputs
+ * are compiled into whenever they are assigned or changed, so that the
+ * per-frame layout and style computations never parse strings.
+ */
+
+
+#pragma once
+#include "base.hpp"
+#include "render.hpp"
+
+
+namespace SFUI {
+
+    /**
+     * @namespace CompiledProp
+     * @brief Defines "compiled properties" used by SFUI components for layout and style.
+     *
+     * These types represent raw property values after their string forms
+     * (percentages, keywords) have been parsed once into numeric values.
+     */
+    namespace CompiledProp {
+
+        /**
+         * @brief Unit of a compiled dimension value.
+         */
+        enum class Unit { Absolute, Percent, Auto, Invalid };
+
+        /**
+         * @brief Compiled form of a Dimension prop.
+         */
+        struct Dimension {
+            /**
+             * @brief Unit the value is expressed in.
+             */
+            SFUI::CompiledProp::Unit unit = SFUI::CompiledProp::Unit::Absolute;
+
+            /**
+             * @brief Pixel amount for absolute units, or unclamped fraction (0.5 for "50%") for percent units.
+             */
+            SFUI::Float value = 0.0f;
+
+            /**
+             * @brief Equality operator for compiled dimensions.
+             */
+            bool operator==(const Dimension&) const = default;
+        };
+
+        /**
+         * @brief Compiled form of a UniQuad prop, ordered as its x, y, z, and w sub-props.
+         */
+        struct UniQuad {
+            /**
+             * @brief Compiled dimension of each of the four sides or corners.
+             */
+            SFUI::Array<SFUI::CompiledProp::Dimension, 4> values;
+
+            /**
+             * @brief Equality operator for compiled uni-quads.
+             */
+            bool operator==(const UniQuad&) const = default;
+        };
+
+        /**
+         * @brief Style-related compiled properties for components.
+         *
+         * This namespace contains the compiled forms of the component-specific
+         * style props that are resolved during every component update.
+         */
+        namespace Style {
+
+            /**
+             * @brief Style compiled properties specific to Button components.
+             */
+            struct Button {
+                /**
+                 * @brief Width of the focus outline.
+                 */
+                SFUI::CompiledProp::Dimension focusWidth;
+
+                /**
+                 * @brief Offset of the focus outline from the button.
+                 */
+                SFUI::CompiledProp::Dimension focusOffset;
+
+                /**
+                 * @brief Padding around the tool-tip text.
+                 */
+                SFUI::CompiledProp::UniQuad toolTipPadding;
+
+                /**
+                 * @brief Resolved fill color while hovered.
+                 */
+                SFUI::Optional<SFUI::Color> hoveredFillColor;
+
+                /**
+                 * @brief Resolved border color while hovered.
+                 */
+                SFUI::Optional<SFUI::Color> hoveredBorderColor;
+
+                /**
+                 * @brief Resolved fill color while pressed.
+                 */
+                SFUI::Optional<SFUI::Color> pressedFillColor;
+
+                /**
+                 * @brief Resolved border color while pressed.
+                 */
+                SFUI::Optional<SFUI::Color> pressedBorderColor;
+
+                /**
+                 * @brief Resolved fill color while disabled.
+                 */
+                SFUI::Optional<SFUI::Color> disabledFillColor;
+
+                /**
+                 * @brief Resolved border color while disabled.
+                 */
+                SFUI::Optional<SFUI::Color> disabledBorderColor;
+            };
+
+            /**
+             * @brief Style compiled properties specific to Label components.
+             */
+            struct Label {
+                /**
+                 * @brief Resolved text fill color.
+                 */
+                SFUI::Color textColor;
+
+                /**
+                 * @brief Resolved text outline color.
+                 */
+                SFUI::Color textOutlineColor;
+            };
+
+            /**
+             * @brief Style compiled properties specific to TextField components.
+             */
+            struct TextField {
+                /**
+                 * @brief Inset of the input text from the text field bounds.
+                 */
+                SFUI::CompiledProp::UniQuad textInset;
+            };
+
+            /**
+             * @brief Style compiled properties specific to Slider components.
+             */
+            struct Slider {
+                /**
+                 * @brief Width of the slider thumb.
+                 */
+                SFUI::CompiledProp::Dimension thumbWidth;
+
+                /**
+                 * @brief Width of the slider track.
+                 */
+                SFUI::CompiledProp::Dimension trackWidth;
+
+                /**
+                 * @brief Optional width of the progressed portion of the slider track.
+                 */
+                SFUI::Optional<SFUI::CompiledProp::Dimension> trackProgressedWidth;
+            };
+        }
+    }
+}
@@ -139,6 +139,14 @@ namespace SFUI {
                  */
                 SFUI::Prop::Color shadowFillColor = SFUI::Color(0, 0, 0, 0);
 
+                /**
+                 * @brief Whether the component and its children are drawn once into a cached texture layer.
+                 *
+                 * The layer is redrawn only when a component of the subtree changes, which suits
+                 * panels that rarely change after construction.
+                 */
+                SFUI::Prop::Binary cacheAsLayer = false;
+
                 /**
                  * @brief Equality operator for Component style properties.
                  */
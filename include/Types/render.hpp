@@ -22,12 +22,16 @@ namespace SFUI {
 
     using FloatRect = sf::FloatRect;
 
+    using IntRect = sf::IntRect;
+
     using Color = sf::Color;
 
     using Text = sf::Text;
 
     using Font = sf::Font;
 
+    using Glyph = sf::Glyph;
+
     using Clock = sf::Clock;
 
     using Time = sf::Time;
@@ -54,7 +58,21 @@ namespace SFUI {
 
     using PrimitiveType = sf::PrimitiveType;
 
+    using Vertex = sf::Vertex;
+
     using VertexArray = sf::VertexArray;
 
+    using VertexBuffer = sf::VertexBuffer;
+
+    using Drawable = sf::Drawable;
+
+    using Transform = sf::Transform;
+
+    using RenderStates = sf::RenderStates;
+
+    using BlendMode = sf::BlendMode;
+
+    using View = sf::View;
+
     using Shader = sf::Shader;
 }
@@ -0,0 +1,102 @@
+/**
+ * @file ArcTessellator.cpp
+ * @brief Implements the SFUI ArcTessellator kernel.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI ArcTessellator class. It handles:
+ *   - Choosing arc resolutions from a screen-space error tolerance
+ *   - Building the quarter-circle tables of every arc resolution
+ *   - Rotating tabulated points into any quadrant without trigonometry
+ *   - Scaling and offsetting arc points into position
+ *
+ * It works in conjunction with ArcTessellator.hpp to provide full functionality
+ * for rounded corner geometry.
+ */
+
+
+#include "Base/ArcTessellator.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * @brief Get the number of segments used for a quarter circle of a radius.
+ *
+ * A chord spanning an angle of a circle strays from it by radius * (1 - cos(angle / 2)), so
+ * the largest angle within the tolerance follows from the on-screen radius. The quality part of
+ * the detail scales the radius, which is the same as dividing the tolerance.
+ *
+ * @param radius The radius of the arc.
+ * @param detail The level of detail, the product of the view scale and the quality factor.
+ *
+ * @return The segment count between minResolution and maxResolution.
+ */
+SFUI::Int SFUI::ArcTessellator::getResolution(SFUI::Float radius, SFUI::Float detail) {
+    SFUI::Float screenRadius = radius * detail;
+    if (screenRadius <= TOLERANCE) return minResolution;
+    SFUI::Double segmentAngle = 2.0 * std::acos(1.0 - TOLERANCE / screenRadius);
+    return std::clamp(static_cast<SFUI::Int>(std::ceil((M_PI / 2.0) / segmentAngle)), minResolution, maxResolution);
+}
+
+
+/**
+ * @brief Compute the points of a quarter-circle arc.
+ *
+ * The tabulated 0 to 90 degree points are rotated into the arc's quadrant by swapping and
+ * negating their components, which is exact for multiples of 90 degrees.
+ *
+ * @param center The center of the arc.
+ * @param radius The radius of the arc.
+ * @param startAngleDeg The starting angle in degrees, a multiple of 90.
+ * @param resolution The segment count of the arc.
+ * @param pointsX The output x coordinates.
+ * @param pointsY The output y coordinates.
+ */
+SFUI::Void SFUI::ArcTessellator::tessellate(SFUI::Vector2f center, SFUI::Float radius, SFUI::Float startAngleDeg, SFUI::Int resolution, SFUI::Float* pointsX, SFUI::Float* pointsY) {
+    resolution = std::clamp(resolution, minResolution, maxResolution);
+    const SFUI::ArcTessellator::QuarterCircle& quarterCircle = getQuarterCircles()[resolution];
+
+    // Quadrant Rotation as a Signed Component Swap //
+    static constexpr SFUI::Float quadrantCosines[4] = {1.0f, 0.0f, -1.0f, 0.0f};
+    static constexpr SFUI::Float quadrantSines[4] = {0.0f, 1.0f, 0.0f, -1.0f};
+    SFUI::Int quadrant = ((static_cast<SFUI::Int>(std::lround(startAngleDeg / 90.0f)) % 4) + 4) % 4;
+    SFUI::Float xFromCosine = radius * quadrantCosines[quadrant];
+    SFUI::Float xFromSine = -radius * quadrantSines[quadrant];
+    SFUI::Float yFromCosine = radius * quadrantSines[quadrant];
+    SFUI::Float yFromSine = radius * quadrantCosines[quadrant];
+
+    const SFUI::Float* cosines = quarterCircle.cosines.data();
+    const SFUI::Float* sines = quarterCircle.sines.data();
+    for (SFUI::Int i = 0; i <= resolution; i++) {
+        pointsX[i] = center.x + xFromCosine * cosines[i] + xFromSine * sines[i];
+        pointsY[i] = center.y + yFromCosine * cosines[i] + yFromSine * sines[i];
+    }
+}
+
+
+/**
+ * @brief Get the quarter-circle table of every resolution, built on first use.
+ *
+ * The end points are stored exactly so that adjacent arcs and edges meet without cracks.
+ *
+ * @return The tables indexed by resolution.
+ */
+const std::array<SFUI::ArcTessellator::QuarterCircle, SFUI::ArcTessellator::maxPointCount>& SFUI::ArcTessellator::getQuarterCircles() {
+    static const std::array<SFUI::ArcTessellator::QuarterCircle, maxPointCount> quarterCircles = [] {
+        std::array<SFUI::ArcTessellator::QuarterCircle, maxPointCount> tables{};
+        for (SFUI::Int resolution = minResolution; resolution <= maxResolution; resolution++) {
+            for (SFUI::Int i = 0; i <= resolution; i++) {
+                SFUI::Double angle = (M_PI / 2.0) * i / resolution;
+                tables[resolution].cosines[i] = static_cast<SFUI::Float>(std::cos(angle));
+                tables[resolution].sines[i] = static_cast<SFUI::Float>(std::sin(angle));
+            }
+            tables[resolution].cosines[resolution] = 0.0f;
+            tables[resolution].sines[resolution] = 1.0f;
+        }
+        return tables;
+    }();
+    return quarterCircles;
+}
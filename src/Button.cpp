@@ -50,6 +50,7 @@ SFUI::Button::Button(SFUI::String componentID) :
  */
 SFUI::Void SFUI::Button::handleEvent(const SFUI::Event& event) {
     if (state.isDisabled) return;
+    const SFUI::Array<SFUI::Bool, 5> previousInteraction = {isHovered, isLeftPressed, isRightPressed, isMiddlePressed, isShowingToolTip};
 
     // Mouse Moved Event Handling //
     if (const SFUI::Event::MouseMoved* mouseMovedEvent = event.getIf<SFUI::Event::MouseMoved>()) {
@@ -163,6 +164,10 @@ SFUI::Void SFUI::Button::handleEvent(const SFUI::Event& event) {
             if (behavior.onBlur) behavior.onBlur(componentID);
         }
     }
+
+    // Interaction Changes Affect the Dynamic Colors and Inner Components //
+    const SFUI::Array<SFUI::Bool, 5> currentInteraction = {isHovered, isLeftPressed, isRightPressed, isMiddlePressed, isShowingToolTip};
+    if (currentInteraction != previousInteraction) markStyleDirty();
 }
 
 
@@ -170,11 +175,24 @@ SFUI::Void SFUI::Button::handleEvent(const SFUI::Event& event) {
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Button::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
-    focus.preUpdate();
-    toolTip.preUpdate();
+    SFUI::Bool styleChanged = commitProps(committedStyle, this->style);
+    SFUI::Bool stateChanged = commitProps(committedState, this->state);
+    if (styleChanged) {
+        compiledButtonStyle.focusWidth = compileDimensionSubProp(style.focusWidth);
+        compiledButtonStyle.focusOffset = compileDimensionSubProp(style.focusOffset);
+        compiledButtonStyle.toolTipPadding = compileUniQuadSubProp(style.toolTipPadding);
+        compiledButtonStyle.hoveredFillColor = compileOptionalColorSubProp(style.hoveredFillColor);
+        compiledButtonStyle.hoveredBorderColor = compileOptionalColorSubProp(style.hoveredBorderColor);
+        compiledButtonStyle.pressedFillColor = compileOptionalColorSubProp(style.pressedFillColor);
+        compiledButtonStyle.pressedBorderColor = compileOptionalColorSubProp(style.pressedBorderColor);
+        compiledButtonStyle.disabledFillColor = compileOptionalColorSubProp(style.disabledFillColor);
+        compiledButtonStyle.disabledBorderColor = compileOptionalColorSubProp(style.disabledBorderColor);
+    }
+    if (styleChanged || stateChanged) markStyleDirty();
+    preUpdateInnerComponent(focus);
+    preUpdateInnerComponent(toolTip);
 }
 
 
@@ -185,16 +203,29 @@ SFUI::Void SFUI::Button::preUpdate() {
  */
 SFUI::Void SFUI::Button::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeDynamicColors();
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeDynamicColors();
+        computeStyles();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeFocus();
     computeToolTip();
+    clearDirtyFlags();
+
+    // Keep Updating While the Tool-Tip Hover Timer is Running //
+    if (!style.toolTipText.empty() && style.toolTipFont && (isHovered || state.isFocused) && !isShowingToolTip)
+        markStyleDirty();
 }
 
 
@@ -205,12 +236,7 @@ SFUI::Void SFUI::Button::update(const SFUI::Vector2u renderTargetSize) {
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::Button::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
+    drawMesh(drawTarget);
 }
 
 
@@ -231,29 +257,75 @@ SFUI::Void SFUI::Button::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::Rende
 }
 
 
+/**
+ * @brief Draw the button's focus outline and tooltip through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Button::drawOverlayBatched(SFUI::RenderBatch& renderBatch) {
+    if (state.isFocused) focus.drawBatched(renderBatch);
+    if (!style.toolTipText.empty() && isShowingToolTip) toolTip.drawBatched(renderBatch);
+}
+
+
+/**
+ * @brief Check if the button must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return True if the button is hovered, pressed, focused, or showing its tool-tip, false otherwise.
+ */
+SFUI::Bool SFUI::Button::isMouseEngaged() const {
+    return isHovered || isLeftPressed || isRightPressed || isMiddlePressed || isShowingToolTip || state.isFocused;
+}
+
+
+/**
+ * @brief Check if the button must receive keyboard and text events.
+ *
+ * @return True if the button is focused or showing its tool-tip, false otherwise.
+ */
+SFUI::Bool SFUI::Button::isKeyboardEngaged() const {
+    return state.isFocused || isShowingToolTip;
+}
+
+
+/**
+ * @brief Get the event types consumed by the button.
+ *
+ * @return Mouse and keyboard events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Button::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = true;
+    subscriptions.keyboard = true;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Compute dynamic colors based on button state.
  */
 SFUI::Void SFUI::Button::computeDynamicColors() {
-    computedStyle.fillColor = resolveColorSubProp(style.fillColor);
-    computedStyle.borderColor = resolveColorSubProp(style.borderColor);
+    computedStyle.fillColor = compiledStyle.fillColor;
+    computedStyle.borderColor = compiledStyle.borderColor;
     if (state.isDisabled) {
-        if (style.disabledFillColor.has_value())
-            computedStyle.fillColor = resolveColorSubProp(style.disabledFillColor.value());
-        if (style.disabledBorderColor.has_value())
-            computedStyle.borderColor = resolveColorSubProp(style.disabledBorderColor.value());
+        if (compiledButtonStyle.disabledFillColor.has_value())
+            computedStyle.fillColor = compiledButtonStyle.disabledFillColor.value();
+        if (compiledButtonStyle.disabledBorderColor.has_value())
+            computedStyle.borderColor = compiledButtonStyle.disabledBorderColor.value();
     }
     else if ((isLeftPressed || isRightPressed || isMiddlePressed) && isHovered) {
-        if (style.pressedFillColor.has_value())
-            computedStyle.fillColor = resolveColorSubProp(style.pressedFillColor.value());
-        if (style.pressedBorderColor.has_value())
-            computedStyle.borderColor = resolveColorSubProp(style.pressedBorderColor.value());
+        if (compiledButtonStyle.pressedFillColor.has_value())
+            computedStyle.fillColor = compiledButtonStyle.pressedFillColor.value();
+        if (compiledButtonStyle.pressedBorderColor.has_value())
+            computedStyle.borderColor = compiledButtonStyle.pressedBorderColor.value();
     }
     else if (isHovered) {
-        if (style.hoveredFillColor.has_value())
-            computedStyle.fillColor = resolveColorSubProp(style.hoveredFillColor.value());
-        if (style.hoveredBorderColor.has_value())
-            computedStyle.borderColor = resolveColorSubProp(style.hoveredBorderColor.value());
+        if (compiledButtonStyle.hoveredFillColor.has_value())
+            computedStyle.fillColor = compiledButtonStyle.hoveredFillColor.value();
+        if (compiledButtonStyle.hoveredBorderColor.has_value())
+            computedStyle.borderColor = compiledButtonStyle.hoveredBorderColor.value();
     }
 }
 
@@ -262,43 +334,10 @@ SFUI::Void SFUI::Button::computeDynamicColors() {
  * @brief Compute the focus graphics for the Button component.
  */
 SFUI::Void SFUI::Button::computeFocus() {
-    // Focus Width //
-    SFUI::Float computedFocusWidth = 0.0f;
-    if (std::holds_alternative<SFUI::Float>(style.focusWidth))
-        computedFocusWidth = std::get<SFUI::Float>(style.focusWidth);
-    else if (std::holds_alternative<SFUI::String>(style.focusWidth)) {
-        SFUI::String focusWidthString = std::get<SFUI::String>(style.focusWidth);
-        if (focusWidthString.size() > 1 && focusWidthString.back() == '%') {
-            focusWidthString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempFocusWidth = std::stod(focusWidthString, &index);
-                if (index == focusWidthString.size()) {
-                    SFUI::Float relativeFocusWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedFocusWidth = relativeFocusWidthFactor * std::clamp(static_cast<SFUI::Float>(tempFocusWidth) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
-
-    // Focus Offset //
-    SFUI::Float computedFocusOffset = 0.0f;
-    if (std::holds_alternative<SFUI::Float>(style.focusOffset))
-        computedFocusOffset = std::get<SFUI::Float>(style.focusOffset);
-    else if (std::holds_alternative<SFUI::String>(style.focusOffset)) {
-        SFUI::String focusOffsetString = std::get<SFUI::String>(style.focusOffset);
-        if (focusOffsetString.size() > 1 && focusOffsetString.back() == '%') {
-            focusOffsetString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempFocusOffset = std::stod(focusOffsetString, &index);
-                if (index == focusOffsetString.size()) {
-                    SFUI::Float relativeFocusOffsetFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedFocusOffset = relativeFocusOffsetFactor * std::clamp(static_cast<SFUI::Float>(tempFocusOffset) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
+    // Focus Width and Offset //
+    SFUI::Float relativeFocusFactor = std::min(computedLayout.size.x, computedLayout.size.y);
+    SFUI::Float computedFocusWidth = resolveDimensionSubProp(compiledButtonStyle.focusWidth, relativeFocusFactor, 0.5f);
+    SFUI::Float computedFocusOffset = resolveDimensionSubProp(compiledButtonStyle.focusOffset, relativeFocusFactor, 0.5f);
 
     // Focus Prop Channeling //
     focus.layout.width = computedLayout.size.x + (computedFocusOffset * 2.0f) + (computedFocusWidth * 2.0f);
@@ -309,7 +348,7 @@ SFUI::Void SFUI::Button::computeFocus() {
     focus.style.cornerRadius = style.focusCornerRadius;
     focus.style.fillColor = SFUI::Color(0, 0, 0, 0);
     focus.style.borderColor = style.focusFillColor;
-    focus.update(renderTargetSize);
+    updateInnerComponent(focus);
 }
 
 
@@ -336,7 +375,7 @@ SFUI::Void SFUI::Button::computeToolTip() {
     }
 
     // Tool Tip Prop Channeling //
-    SFUI::Vector4f toolTipPadding = resolveUniQuadSubProp(computedLayout.size, style.toolTipPadding);
+    SFUI::Vector4f toolTipPadding = resolveUniQuadSubProp(computedLayout.size, compiledButtonStyle.toolTipPadding);
     toolTip.layout.width = toolTip.getTextBounds().size.x + (toolTipPadding.x + toolTipPadding.y);
     toolTip.layout.height = toolTip.getTextBounds().size.y + (toolTipPadding.z + toolTipPadding.w);
     toolTip.style.textAlignHorizontal = "center";
@@ -347,5 +386,5 @@ SFUI::Void SFUI::Button::computeToolTip() {
     toolTip.style.textSize = style.toolTipTextSize;
     toolTip.style.fillColor = style.toolTipFillColor;
     toolTip.style.textColor = style.toolTipTextColor;
-    toolTip.update(renderTargetSize);
+    updateInnerComponent(toolTip);
 }
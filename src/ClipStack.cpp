@@ -0,0 +1,164 @@
+/**
+ * @file ClipStack.cpp
+ * @brief Implements the SFUI ClipStack clip rectangle stack.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI ClipStack class. It handles:
+ *   - Intersecting nested clip rectangles on the CPU
+ *   - Converting clip rectangles to view scissors
+ *   - Narrowing and restoring the scissor of components drawn directly
+ *   - Skipping scissor updates that would not change the view
+ *
+ * It works in conjunction with ClipStack.hpp to provide full functionality
+ * for clipping the UI tree.
+ */
+
+
+#include "Base/ClipStack.hpp"
+#include <algorithm>
+
+
+/**
+ * @brief Constructor for ClipStack.
+ */
+SFUI::ClipStack::ClipStack() {}
+
+
+/**
+ * @brief Empty the stack.
+ */
+SFUI::Void SFUI::ClipStack::reset() {
+    clipRects.clear();
+}
+
+
+/**
+ * @brief Push a clip rectangle, intersected with the current clip.
+ *
+ * A clip disjoint from the current one collapses to an empty rectangle, which clips everything.
+ *
+ * @param clipRect The clip rectangle in render target coordinates.
+ */
+SFUI::Void SFUI::ClipStack::push(const SFUI::FloatRect& clipRect) {
+    if (clipRects.empty()) {
+        clipRects.push_back(clipRect);
+        return;
+    }
+    const SFUI::FloatRect& parentClip = clipRects.back();
+    clipRects.push_back(parentClip.findIntersection(clipRect).value_or(SFUI::FloatRect(parentClip.position, {0.0f, 0.0f})));
+}
+
+
+/**
+ * @brief Restore the clip that was active before the last push().
+ */
+SFUI::Void SFUI::ClipStack::pop() {
+    if (!clipRects.empty()) clipRects.pop_back();
+}
+
+
+/**
+ * @brief Get the effective clip rectangle.
+ *
+ * @return The top of the stack, or an empty optional if unclipped.
+ */
+SFUI::Optional<SFUI::FloatRect> SFUI::ClipStack::getClip() const {
+    if (clipRects.empty()) return std::nullopt;
+    return clipRects.back();
+}
+
+
+/**
+ * @brief Set the scissor of a render target's view to a clip rectangle if it is not already set.
+ *
+ * SFML applies the scissor of the view with the view itself, before the next draw, and disables
+ * or enables the scissor test to match it. Clipping therefore survives any view or render target
+ * change that makes SFML apply the view again, and follows views that scale or move the UI.
+ *
+ * @param drawTarget The render target whose view is clipped.
+ * @param clipRect The clip rectangle in the coordinates of the view, or an empty optional to disable clipping.
+ */
+SFUI::Void SFUI::ClipStack::apply(SFUI::RenderTarget& drawTarget, const SFUI::Optional<SFUI::FloatRect>& clipRect) {
+    SFUI::FloatRect scissor({0.0f, 0.0f}, {1.0f, 1.0f});
+    if (clipRect.has_value()) scissor = toScissor(drawTarget.getView(), clipRect.value());
+    setScissor(drawTarget, scissor);
+}
+
+
+/**
+ * @brief Narrow the scissor of a render target's view to a clip rectangle, within the scissor already set.
+ *
+ * Components drawn directly to a render target are drawn within the scissor of their ancestors,
+ * so their own clip must not widen it. A clip outside of the current scissor leaves an empty one.
+ *
+ * @param drawTarget The render target whose view is clipped.
+ * @param clipRect The clip rectangle in the coordinates of the view.
+ *
+ * @return The scissor of the view before it was narrowed, to give back to restore().
+ */
+SFUI::FloatRect SFUI::ClipStack::intersect(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& clipRect) {
+    SFUI::FloatRect previousScissor = drawTarget.getView().getScissor();
+    SFUI::FloatRect scissor = toScissor(drawTarget.getView(), clipRect);
+    setScissor(drawTarget, previousScissor.findIntersection(scissor).value_or(SFUI::FloatRect(scissor.position, {0.0f, 0.0f})));
+    return previousScissor;
+}
+
+
+/**
+ * @brief Set the scissor of a render target's view back to the one it had before intersect().
+ *
+ * @param drawTarget The render target whose view is clipped.
+ * @param scissor The scissor returned by intersect().
+ */
+SFUI::Void SFUI::ClipStack::restore(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& scissor) {
+    setScissor(drawTarget, scissor);
+}
+
+
+/**
+ * @brief Convert a clip rectangle to a view scissor.
+ *
+ * The corners of the clip are projected by the view and placed in its viewport, which gives
+ * them as a ratio of the render target. The result is kept within the unit rectangle, as SFML
+ * requires of a scissor.
+ *
+ * @param view The view the clip rectangle is given in.
+ * @param clipRect The clip rectangle in the coordinates of the view.
+ *
+ * @return The scissor as a ratio of the render target, within the unit rectangle.
+ */
+SFUI::FloatRect SFUI::ClipStack::toScissor(const SFUI::View& view, const SFUI::FloatRect& clipRect) {
+    const SFUI::FloatRect& viewport = view.getViewport();
+    sf::Vector2f topLeft = view.getTransform().transformPoint(clipRect.position);
+    sf::Vector2f bottomRight = view.getTransform().transformPoint(clipRect.position + clipRect.size);
+
+    // Projected Coordinates Run From -1 to 1, With y Pointing Up //
+    SFUI::Float left = viewport.position.x + (std::min(topLeft.x, bottomRight.x) + 1.0f) / 2.0f * viewport.size.x;
+    SFUI::Float right = viewport.position.x + (std::max(topLeft.x, bottomRight.x) + 1.0f) / 2.0f * viewport.size.x;
+    SFUI::Float top = viewport.position.y + (1.0f - std::max(topLeft.y, bottomRight.y)) / 2.0f * viewport.size.y;
+    SFUI::Float bottom = viewport.position.y + (1.0f - std::min(topLeft.y, bottomRight.y)) / 2.0f * viewport.size.y;
+
+    left = std::clamp(left, 0.0f, 1.0f);
+    top = std::clamp(top, 0.0f, 1.0f);
+    right = std::clamp(right, left, 1.0f);
+    bottom = std::clamp(bottom, top, 1.0f);
+    return SFUI::FloatRect({left, top}, {right - left, bottom - top});
+}
+
+
+/**
+ * @brief Set the scissor of a render target's view if it is not already set.
+ *
+ * @param drawTarget The render target whose view is clipped.
+ * @param scissor The scissor as a ratio of the render target.
+ */
+SFUI::Void SFUI::ClipStack::setScissor(SFUI::RenderTarget& drawTarget, const SFUI::FloatRect& scissor) {
+    if (drawTarget.getView().getScissor() == scissor) return;
+
+    SFUI::View view = drawTarget.getView();
+    view.setScissor(scissor);
+    drawTarget.setView(view);
+}
@@ -18,6 +18,22 @@
 
 
 #include "Base/Component.hpp"
+#include "Base/ArcTessellator.hpp"
+
+
+/**
+ * @brief Hex digit lookup table, mapping '0'-'9', 'a'-'f' and 'A'-'F' to their values and everything else to HEX_DIGIT_INVALID.
+ */
+const SFUI::Array<SFUI::UnsignedInt8, 256> SFUI::Component::HEX_DIGIT_VALUES = [] {
+    SFUI::Array<SFUI::UnsignedInt8, 256> hexDigitValues;
+    hexDigitValues.fill(HEX_DIGIT_INVALID);
+    for (SFUI::UnsignedInt8 i = 0; i < 10; i++) hexDigitValues['0' + i] = i;
+    for (SFUI::UnsignedInt8 i = 0; i < 6; i++) {
+        hexDigitValues['a' + i] = 10 + i;
+        hexDigitValues['A' + i] = 10 + i;
+    }
+    return hexDigitValues;
+}();
 
 
 /**
@@ -49,6 +65,8 @@ SFUI::Void SFUI::Component::addChild(SFUI::UniquePointer<SFUI::Component> newChi
     newChild->setParent(this);
     children.push_back(std::move(newChild));
     computedChildrenLayout.emplace_back(SFUI::Component::ComputedChildLayout{{0.0f, 0.0f}, {0, 0}, 0.0f});
+    markChildrenDirty();
+    markTreeStructureDirty();
 }
 
 
@@ -63,6 +81,31 @@ SFUI::Void SFUI::Component::addChildren(SFUI::Vector<SFUI::UniquePointer<SFUI::C
         children.push_back(std::move(newChildren[i]));
         computedChildrenLayout.emplace_back(SFUI::Component::ComputedChildLayout{{0.0f, 0.0f}, {0, 0}, 0.0f});
     }
+    markChildrenDirty();
+    markTreeStructureDirty();
+}
+
+
+/**
+ * @brief Remove a child component and its subtree from this component.
+ *
+ * @param child The child component to remove.
+ *
+ * @return The detached child, or nullptr if it is not a child of this component.
+ */
+SFUI::UniquePointer<SFUI::Component> SFUI::Component::removeChild(const SFUI::Component* child) {
+    for (SFUI::Size i = 0; i < children.size(); i++) {
+        if (children[i].get() != child) continue;
+        SFUI::UniquePointer<SFUI::Component> removedChild = std::move(children[i]);
+        children.erase(children.begin() + i);
+        computedChildrenLayout.erase(computedChildrenLayout.begin() + i);
+        removedChild->setParent(nullptr);
+        removedChild->treeStructureDirty = true;
+        markChildrenDirty();
+        markTreeStructureDirty();
+        return removedChild;
+    }
+    return nullptr;
 }
 
 
@@ -72,6 +115,12 @@ SFUI::Void SFUI::Component::addChildren(SFUI::Vector<SFUI::UniquePointer<SFUI::C
  * @param childComputedLayout The computed baseLayout information computed from the parent component.
  */
 SFUI::Void SFUI::Component::updateChildFromParent(SFUI::Component::ComputedChildLayout computedChildLayout) {
+    // The Parent is Mid-Update and Its Children Come After It in the Update Traversal //
+    if (computedLayout.size != computedChildLayout.size)
+        dirtyFlags.layout = dirtyFlags.style = dirtyFlags.geometry = dirtyFlags.children = true;
+    else if (computedLayout.position != computedChildLayout.position)
+        dirtyFlags.geometry = dirtyFlags.children = true;
+
     computedLayout.size = computedChildLayout.size;
     computedLayout.position = computedChildLayout.position;
     computedLayout.margin = computedChildLayout.margin;
@@ -128,18 +177,340 @@ const SFUI::Vector4f& SFUI::Component::getMargin() const {
 }
 
 
+/**
+ * @brief Draw the component's background, border and shadow geometry through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Component::drawBatched(SFUI::RenderBatch& renderBatch) {
+    if (mesh) renderBatch.append(*mesh, meshOffset);
+}
+
+
+/**
+ * @brief Draw the component's overlay pass through a render batch.
+ *
+ * Components draw no overlay by default.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Component::drawOverlayBatched(SFUI::RenderBatch& renderBatch) {}
+
+
+/**
+ * @brief Get the bounds used to index this component for mouse event routing.
+ *
+ * @return The layout box of the component.
+ */
+SFUI::FloatRect SFUI::Component::getHitBounds() const {
+    return SFUI::FloatRect(
+        {static_cast<SFUI::Float>(computedLayout.position.x), static_cast<SFUI::Float>(computedLayout.position.y)},
+        computedLayout.size
+    );
+}
+
+
+/**
+ * @brief Get the bounds of everything the component draws in the UI tree pass.
+ *
+ * The largest shadow layer is the layout box moved by the shadow offset, and every other
+ * layer is inset from it, so the draw bounds are the union of the layout box and that layer.
+ *
+ * @return The draw bounds of the component.
+ */
+SFUI::FloatRect SFUI::Component::getDrawBounds() const {
+    SFUI::FloatRect layoutBox = getHitBounds();
+    if (computedStyle.shadowFillColor.a == 0) return layoutBox;
+    SFUI::FloatRect shadowBox({layoutBox.position.x + computedStyle.shadowOffset.x, layoutBox.position.y + computedStyle.shadowOffset.y}, layoutBox.size);
+    return unionBounds(layoutBox, shadowBox);
+}
+
+
+/**
+ * @brief Get a rectangle the component's own geometry covers with fully opaque pixels.
+ *
+ * Rounded corners are excluded by keeping the larger of the horizontal and vertical bands
+ * of the layout box that lie between the corner arcs. The border is blended over the opaque
+ * background or drawn opaque itself, so it never makes the rectangle translucent.
+ *
+ * @return The opaque rectangle, or an empty optional if the background is translucent.
+ */
+SFUI::Optional<SFUI::FloatRect> SFUI::Component::getOpaqueBounds() const {
+    if (computedStyle.fillColor.a < 255 || !mesh || mesh->isEmpty()) return std::nullopt;
+    SFUI::FloatRect layoutBox = SFUI::Component::getHitBounds();
+    SFUI::Float leftInset = std::max(computedStyle.cornerRadius.x, computedStyle.cornerRadius.z);
+    SFUI::Float rightInset = std::max(computedStyle.cornerRadius.y, computedStyle.cornerRadius.w);
+    SFUI::Float topInset = std::max(computedStyle.cornerRadius.x, computedStyle.cornerRadius.y);
+    SFUI::Float bottomInset = std::max(computedStyle.cornerRadius.z, computedStyle.cornerRadius.w);
+
+    SFUI::FloatRect horizontalBand({layoutBox.position.x, layoutBox.position.y + topInset}, {layoutBox.size.x, layoutBox.size.y - topInset - bottomInset});
+    SFUI::FloatRect verticalBand({layoutBox.position.x + leftInset, layoutBox.position.y}, {layoutBox.size.x - leftInset - rightInset, layoutBox.size.y});
+    SFUI::FloatRect opaqueBounds = horizontalBand.size.x * horizontalBand.size.y >= verticalBand.size.x * verticalBand.size.y ? horizontalBand : verticalBand;
+    if (opaqueBounds.size.x <= 0.0f || opaqueBounds.size.y <= 0.0f) return std::nullopt;
+    return opaqueBounds;
+}
+
+
+/**
+ * @brief Check if the component and its children are drawn through a cached texture layer.
+ *
+ * @return True if the committed cacheAsLayer style prop is set, false otherwise.
+ */
+SFUI::Bool SFUI::Component::isCachedAsLayer() const {
+    return baseStyle.cacheAsLayer;
+}
+
+
+/**
+ * @brief Get the smallest rectangle containing two rectangles.
+ *
+ * @param a The first rectangle.
+ * @param b The second rectangle.
+ *
+ * @return The union bounds of both rectangles.
+ */
+SFUI::FloatRect SFUI::Component::unionBounds(const SFUI::FloatRect& a, const SFUI::FloatRect& b) {
+    SFUI::Float left = std::min(a.position.x, b.position.x);
+    SFUI::Float top = std::min(a.position.y, b.position.y);
+    SFUI::Float right = std::max(a.position.x + a.size.x, b.position.x + b.size.x);
+    SFUI::Float bottom = std::max(a.position.y + a.size.y, b.position.y + b.size.y);
+    return SFUI::FloatRect({left, top}, {right - left, bottom - top});
+}
+
+
+/**
+ * @brief Draw the component's shared mesh at its position.
+ *
+ * @param drawTarget The target to draw on.
+ */
+SFUI::Void SFUI::Component::drawMesh(SFUI::RenderTarget& drawTarget) const {
+    if (!mesh) return;
+    SFUI::Transform transform;
+    transform.translate(meshOffset);
+    drawTarget.draw(*mesh, SFUI::RenderStates(transform));
+}
+
+
+/**
+ * @brief Get the layout box of the component shrunk by its padding.
+ *
+ * @return The content box of the component.
+ */
+SFUI::FloatRect SFUI::Component::getContentBox() const {
+    return SFUI::FloatRect(
+        {computedLayout.position.x + computedLayout.padding.x, computedLayout.position.y + computedLayout.padding.z},
+        {
+            std::max(0.0f, computedLayout.size.x - (computedLayout.padding.x + computedLayout.padding.y)),
+            std::max(0.0f, computedLayout.size.y - (computedLayout.padding.z + computedLayout.padding.w))
+        }
+    );
+}
+
+
+/**
+ * @brief Check if the component must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return false, as plain components do not track mouse interactions.
+ */
+SFUI::Bool SFUI::Component::isMouseEngaged() const {
+    return false;
+}
+
+
+/**
+ * @brief Check if the component must receive keyboard and text events.
+ *
+ * @return true, so custom components receive every keyboard event they subscribe to.
+ */
+SFUI::Bool SFUI::Component::isKeyboardEngaged() const {
+    return true;
+}
+
+
+/**
+ * @brief Get the event types consumed by the component's handleEvent().
+ *
+ * @return Every event type, so custom components keep receiving all events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Component::getEventSubscriptions() const {
+    return {};
+}
+
+
+/**
+ * @brief Flag every computation stage of this component as dirty.
+ */
+SFUI::Void SFUI::Component::markDirty() {
+    dirtyFlags.layout = dirtyFlags.style = dirtyFlags.geometry = dirtyFlags.children = true;
+}
+
+
+/**
+ * @brief Check if any computation stage of this component is dirty.
+ *
+ * @return True if the component needs to be updated, false otherwise.
+ */
+SFUI::Bool SFUI::Component::isDirty() const {
+    return dirtyFlags.layout || dirtyFlags.style || dirtyFlags.geometry || dirtyFlags.children;
+}
+
+
+/**
+ * @brief Flag the layout and everything derived from it as dirty.
+ */
+SFUI::Void SFUI::Component::markLayoutDirty() {
+    dirtyFlags.layout = dirtyFlags.style = dirtyFlags.geometry = dirtyFlags.children = true;
+}
+
+
+/**
+ * @brief Flag the style and geometry as dirty.
+ */
+SFUI::Void SFUI::Component::markStyleDirty() {
+    dirtyFlags.style = dirtyFlags.geometry = true;
+}
+
+
+/**
+ * @brief Flag the children layout as dirty.
+ */
+SFUI::Void SFUI::Component::markChildrenDirty() {
+    dirtyFlags.children = true;
+}
+
+
+/**
+ * @brief Clear all dirty flags once the component has been updated.
+ */
+SFUI::Void SFUI::Component::clearDirtyFlags() {
+    dirtyFlags.layout = dirtyFlags.style = dirtyFlags.geometry = dirtyFlags.children = false;
+}
+
+
+/**
+ * @brief Flag the structure of the tree containing this component as changed.
+ *
+ * The flag is set on the top-most ancestor, which is the root component once the tree is attached to a UIRoot.
+ */
+SFUI::Void SFUI::Component::markTreeStructureDirty() {
+    SFUI::Component* treeRoot = this;
+    while (treeRoot->parent) treeRoot = treeRoot->parent;
+    treeRoot->treeStructureDirty = true;
+}
+
+
+/**
+ * @brief Commit the layout and style props into the base props, flagging what changed.
+ *
+ * A layout change also dirties the parent's children layout, since the parent resolves
+ * this component's size, position, and margin.
+ *
+ * @param layout The current layout props of the component.
+ * @param style The current style props of the component.
+ */
+SFUI::Void SFUI::Component::commitBaseProps(const SFUI::PropGroup::Component::Layout& layout, const SFUI::PropGroup::Component::Style& style) {
+    SFUI::Bool firstCommit = !basePropsCommitted;
+    basePropsCommitted = true;
+    if (firstCommit || baseLayout != layout) {
+        baseLayout = layout;
+        compileLayout();
+        markLayoutDirty();
+        if (parent) parent->markChildrenDirty();
+    }
+    if (firstCommit || baseStyle != style) {
+        baseStyle = style;
+        compileStyle();
+        markStyleDirty();
+    }
+}
+
+
+/**
+ * @brief Compile the committed base layout props into their numeric and enum forms.
+ */
+SFUI::Void SFUI::Component::compileLayout() {
+    // Children Layout Axis //
+    SFUI::String alignDirection = baseLayout.alignDirection;
+    std::transform(alignDirection.begin(), alignDirection.end(), alignDirection.begin(), ::tolower);
+    if (alignDirection == "horizontal") compiledLayout.alignDirection = SFUI::Component::AlignDirection::Horizontal;
+    else compiledLayout.alignDirection = SFUI::Component::AlignDirection::Vertical;
+
+    // Primary (On-Axis) Children Alignment //
+    SFUI::String alignPrimary = baseLayout.alignPrimary;
+    std::transform(alignPrimary.begin(), alignPrimary.end(), alignPrimary.begin(), ::tolower);
+    if (alignPrimary == "end") compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::End;
+    else if (alignPrimary == "center") compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::Center;
+    else if (alignPrimary == "space-between") compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceBetween;
+    else if (alignPrimary == "space-around") compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceAround;
+    else if (alignPrimary == "space-evenly") compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceEvenly;
+    else compiledLayout.alignPrimary = SFUI::Component::AlignPrimary::Start;
+
+    // Secondary (Off-Axis) Children Alignment //
+    SFUI::String alignSecondary = baseLayout.alignSecondary;
+    std::transform(alignSecondary.begin(), alignSecondary.end(), alignSecondary.begin(), ::tolower);
+    if (alignSecondary == "end") compiledLayout.alignSecondary = SFUI::Component::AlignSecondary::End;
+    else if (alignSecondary == "center") compiledLayout.alignSecondary = SFUI::Component::AlignSecondary::Center;
+    else compiledLayout.alignSecondary = SFUI::Component::AlignSecondary::Start;
+
+    // Layout Box Dimensions //
+    compiledLayout.width = compileDimensionSubProp(baseLayout.width);
+    compiledLayout.height = compileDimensionSubProp(baseLayout.height);
+    compiledLayout.padding = compileUniQuadSubProp(baseLayout.padding);
+    compiledLayout.margin = compileUniQuadSubProp(baseLayout.margin);
+}
+
+
+/**
+ * @brief Compile the committed base style props into their numeric and color forms.
+ */
+SFUI::Void SFUI::Component::compileStyle() {
+    compiledStyle.borderWidth = compileDimensionSubProp(baseStyle.borderWidth);
+    compiledStyle.cornerRadius = compileUniQuadSubProp(baseStyle.cornerRadius);
+    compiledStyle.fillColor = resolveColorSubProp(baseStyle.fillColor);
+    compiledStyle.borderColor = resolveColorSubProp(baseStyle.borderColor);
+    compiledStyle.shadowFillColor = resolveColorSubProp(baseStyle.shadowFillColor);
+}
+
+
+/**
+ * @brief Pre-update an inner component and flag this component dirty if the inner component changed.
+ *
+ * @param innerComponent The inner component owned by this component.
+ */
+SFUI::Void SFUI::Component::preUpdateInnerComponent(SFUI::Component& innerComponent) {
+    innerComponent.preUpdate();
+    if (innerComponent.isDirty()) markStyleDirty();
+}
+
+
+/**
+ * @brief Fully update an inner component after its props were channeled from this component.
+ *
+ * The inner component shares the scissor clip of this component, so its hover checks respect it too.
+ *
+ * @param innerComponent The inner component owned by this component.
+ */
+SFUI::Void SFUI::Component::updateInnerComponent(SFUI::Component& innerComponent) {
+    innerComponent.clipBounds = clipBounds;
+    innerComponent.updateContext = updateContext;
+    innerComponent.markDirty();
+    innerComponent.update(renderTargetSize);
+}
+
+
 /**
  * @brief Check if the mouse is hovering over this component.
  *
+ * Points outside of the scissor clip inherited from the ancestors never hover the component.
+ *
  * @param mousePosition The current mouse position.
  *
  * @return True if the mouse is hovering over the component, false otherwise.
  */
 SFUI::Bool SFUI::Component::isMouseHovered(const SFUI::Vector2i& mousePosition) {
     SFUI::Vector2f mousePos(mousePosition.x, mousePosition.y);
-    SFUI::FloatRect cornerBounds = borderRects.getBounds();
-    SFUI::FloatRect edgeBounds = backgroundRects.getBounds();
-    return (cornerBounds.contains(mousePos) || edgeBounds.contains(mousePos));
+    if (clipBounds.has_value() && !clipBounds.value().contains(mousePos)) return false;
+    return SFUI::Component::getHitBounds().contains(mousePos);
 }
 
 
@@ -155,40 +526,19 @@ SFUI::Color SFUI::Component::resolveColorSubProp(const SFUI::Prop::Color& color)
 
     // If Input Fill Color is a 3-Channel Unsigned Byte //
     if (std::holds_alternative<SFUI::Vector3ui8>(color)) {
-        SFUI::Vector3ui8 fillColor = std::get<SFUI::Vector3ui8>(color);
+        const SFUI::Vector3ui8& fillColor = std::get<SFUI::Vector3ui8>(color);
         resolvedFillColor = SFUI::Color(fillColor.x, fillColor.y, fillColor.z, 255);
     }
     // If Input Fill Color is a 4-Channel Unsigned Byte //
     else if (std::holds_alternative<SFUI::Vector4ui8>(color)) {
-        SFUI::Vector4ui8 fillColor = std::get<SFUI::Vector4ui8>(color);
+        const SFUI::Vector4ui8& fillColor = std::get<SFUI::Vector4ui8>(color);
         resolvedFillColor = SFUI::Color(fillColor.x, fillColor.y, fillColor.z, fillColor.w);
     }
     // If Input Fill Color is a Hex String //
     else if (std::holds_alternative<SFUI::String>(color)) {
-        SFUI::String fillColorHexString = std::get<SFUI::String>(color);
-
-        if (!fillColorHexString.empty() && fillColorHexString[0] == '#') {
-            fillColorHexString.erase(0, 1);
-            try {
-                // RRGGBB Oct-String //
-                if (fillColorHexString.length() == 6) {
-                    unsigned int r = std::stoul(fillColorHexString.substr(0, 2), nullptr, 16);
-                    unsigned int g = std::stoul(fillColorHexString.substr(2, 2), nullptr, 16);
-                    unsigned int b = std::stoul(fillColorHexString.substr(4, 2), nullptr, 16);
-                    resolvedFillColor = SFUI::Color(r, g, b, 255);
-                }
-                // RRGGBBAA Hex-String //
-                else if (fillColorHexString.length() == 8) {
-                    unsigned int r = std::stoul(fillColorHexString.substr(0, 2), nullptr, 16);
-                    unsigned int g = std::stoul(fillColorHexString.substr(2, 2), nullptr, 16);
-                    unsigned int b = std::stoul(fillColorHexString.substr(4, 2), nullptr, 16);
-                    unsigned int a = std::stoul(fillColorHexString.substr(6, 2), nullptr, 16);
-                    resolvedFillColor = SFUI::Color(r, g, b, a);
-                }
-            }   catch (...) {
-                resolvedFillColor = SFUI::Color(0, 0, 0, 255);
-            }
-        }
+        const SFUI::String& fillColorHexString = std::get<SFUI::String>(color);
+        if (!fillColorHexString.empty() && fillColorHexString[0] == '#')
+            resolvedFillColor = decodeHexColor(fillColorHexString.data() + 1, fillColorHexString.size() - 1);
     }
     // If Input Fill Color is Already Given as a SFML::Color Type //
     else if (std::holds_alternative<SFUI::Color>(color)) {
@@ -200,95 +550,160 @@ SFUI::Color SFUI::Component::resolveColorSubProp(const SFUI::Prop::Color& color)
 
 
 /**
- * @brief Resolve a UniQuad Sub Property into a Vector4f.
+ * @brief Resolve an optional Color Sub Property, keeping it empty if not set.
  *
- * @param size The size of the component for percentage calculations.
- * @param subProp The UniQuad sub property to resolve.
+ * @param color The optional color sub property to resolve.
  *
- * @return The resolved sub-prop as a Vector4f.
+ * @return The resolved color, or an empty optional.
  */
-SFUI::Vector4f SFUI::Component::resolveUniQuadSubProp(const SFUI::Vector2f& size, const SFUI::Prop::UniQuad& subProp) {
-    SFUI::Vector4f computedSubProp = {0.0f, 0.0f, 0.0f, 0.0f};
-    SFUI::Float subPropSizeFactor = std::min(size.x, size.y);
+SFUI::Optional<SFUI::Color> SFUI::Component::compileOptionalColorSubProp(const SFUI::Optional<SFUI::Prop::Color>& color) {
+    if (!color.has_value()) return std::nullopt;
+    return resolveColorSubProp(color.value());
+}
+
+
+/**
+ * @brief Decode an RRGGBB or RRGGBBAA hex string (without the leading '#') into a color.
+ *
+ * Every digit goes through the lookup table unconditionally and the invalid bits of all
+ * digits are accumulated, so only a single check is made once the channels are decoded.
+ *
+ * @param hexDigits Pointer to the first hex digit.
+ * @param hexLength Number of hex digits, 6 or 8.
+ *
+ * @return The decoded color, opaque black if any digit is invalid, or the default color for other lengths.
+ */
+SFUI::Color SFUI::Component::decodeHexColor(const char* hexDigits, SFUI::Size hexLength) {
+    if (hexLength != 6 && hexLength != 8) return SFUI::Color();
+
+    SFUI::Array<SFUI::UnsignedInt8, 4> channels = {0, 0, 0, 255};
+    SFUI::UnsignedInt8 invalidDigits = 0;
+    for (SFUI::Size i = 0; i < hexLength / 2; i++) {
+        SFUI::UnsignedInt8 high = HEX_DIGIT_VALUES[static_cast<unsigned char>(hexDigits[i * 2])];
+        SFUI::UnsignedInt8 low = HEX_DIGIT_VALUES[static_cast<unsigned char>(hexDigits[i * 2 + 1])];
+        invalidDigits |= high | low;
+        channels[i] = static_cast<SFUI::UnsignedInt8>((high << 4) | (low & 0x0F));
+    }
+    if (invalidDigits & HEX_DIGIT_INVALID) return SFUI::Color(0, 0, 0, 255);
+
+    return SFUI::Color(channels[0], channels[1], channels[2], channels[3]);
+}
+
+
+/**
+ * @brief Compile a Dimension Sub Property into its tagged numeric form.
+ *
+ * Percentages are stored as unclamped fractions, so each use site can apply its own limits.
+ *
+ * @param dimension The dimension sub property to compile.
+ *
+ * @return The compiled dimension.
+ */
+SFUI::CompiledProp::Dimension SFUI::Component::compileDimensionSubProp(const SFUI::Prop::Dimension& dimension) {
+    SFUI::CompiledProp::Dimension compiledDimension;
+
+    // If the Dimension is Already a Numeric Value //
+    if (std::holds_alternative<SFUI::Float>(dimension)) {
+        compiledDimension.value = std::get<SFUI::Float>(dimension);
+        return compiledDimension;
+    }
+
+    // If the Dimension is a Percentage or Keyword String //
+    compiledDimension.unit = SFUI::CompiledProp::Unit::Invalid;
+    const SFUI::String& dimensionString = std::get<SFUI::String>(dimension);
+    if (dimensionString.size() > 1 && dimensionString.back() == '%') {
+        SFUI::String percentString = dimensionString.substr(0, dimensionString.size() - 1);
+        try {
+            SFUI::Size index = 0;
+            SFUI::Double tempPercent = std::stod(percentString, &index);
+            if (index == percentString.size()) {
+                compiledDimension.unit = SFUI::CompiledProp::Unit::Percent;
+                compiledDimension.value = static_cast<SFUI::Float>(tempPercent) / 100.0f;
+            }
+        }   catch (...) {}
+    }
+    else if (dimensionString == "auto") {
+        compiledDimension.unit = SFUI::CompiledProp::Unit::Auto;
+    }
+
+    return compiledDimension;
+}
+
+
+/**
+ * @brief Compile a UniQuad Sub Property into its tagged numeric form.
+ *
+ * @param subProp The UniQuad sub property to compile.
+ *
+ * @return The compiled UniQuad.
+ */
+SFUI::CompiledProp::UniQuad SFUI::Component::compileUniQuadSubProp(const SFUI::Prop::UniQuad& subProp) {
+    SFUI::CompiledProp::UniQuad compiledSubProp;
 
     // If the Sub Prop Holds the Master Value //
     if (std::holds_alternative<SFUI::Prop::Dimension>(subProp)) {
-        SFUI::Prop::Dimension masterSubProp = std::get<SFUI::Prop::Dimension>(subProp);
-        SFUI::Float computedMasterSubProp = 0.0f;
-        if (std::holds_alternative<SFUI::Float>(masterSubProp))
-            computedMasterSubProp = std::get<SFUI::Float>(masterSubProp);
-        else if (std::holds_alternative<SFUI::String>(masterSubProp)) {
-            SFUI::String masterSubPropString = std::get<SFUI::String>(masterSubProp);
-            if (masterSubPropString.size() > 1 && masterSubPropString.back() == '%') {
-                masterSubPropString.pop_back();
-                try {
-                    size_t index = 0;
-                    SFUI::Double tempSubProp = std::stod(masterSubPropString, &index);
-                    if (index == masterSubPropString.size())
-                        computedMasterSubProp = subPropSizeFactor * std::clamp(static_cast<SFUI::Float>(tempSubProp) / 100.0f, 0.0f, 0.5f);
-                }   catch (...) {}
-            }
-        }
-        computedSubProp.x = computedSubProp.y = computedSubProp.z = computedSubProp.w = computedMasterSubProp;
+        SFUI::CompiledProp::Dimension compiledMasterSubProp = compileDimensionSubProp(std::get<SFUI::Prop::Dimension>(subProp));
+        compiledSubProp.values.fill(compiledMasterSubProp);
     }
 
     // If the Sub Prop Holds the Invidiual Inputs Value //
     else if (std::holds_alternative<SFUI::Prop::Vector4dim>(subProp)) {
-        SFUI::Prop::Vector4dim subProps = std::get<SFUI::Prop::Vector4dim>(subProp);
-        SFUI::Array<SFUI::Prop::Dimension, 4> individualSubProps = {subProps.x, subProps.y, subProps.z, subProps.w};
-        SFUI::Array<SFUI::Float, 4> computedIndividualSubProps = {0.0f, 0.0f, 0.0f, 0.0f};
-        for (int i = 0; i < 4; i++) {
-            if (std::holds_alternative<SFUI::Float>(individualSubProps[i]))
-                computedIndividualSubProps[i] = std::get<SFUI::Float>(individualSubProps[i]);
-            else if (std::holds_alternative<SFUI::String>(individualSubProps[i])) {
-                SFUI::String individualSubPropString = std::get<SFUI::String>(individualSubProps[i]);
-                if (individualSubPropString.size() > 1 && individualSubPropString.back() == '%') {
-                    individualSubPropString.pop_back();
-                    try {
-                        size_t index = 0;
-                        SFUI::Double tempSubProp = std::stod(individualSubPropString, &index);
-                        if (index == individualSubPropString.size())
-                            computedIndividualSubProps[i] = subPropSizeFactor * std::clamp(static_cast<SFUI::Float>(tempSubProp) / 100.0f, 0.0f, 0.5f);
-                    }   catch (...) {}
-                }
-            };
-        }
-        computedSubProp.x = computedIndividualSubProps[0];
-        computedSubProp.y = computedIndividualSubProps[1];
-        computedSubProp.z = computedIndividualSubProps[2];
-        computedSubProp.w = computedIndividualSubProps[3];
+        const SFUI::Prop::Vector4dim& subProps = std::get<SFUI::Prop::Vector4dim>(subProp);
+        compiledSubProp.values[0] = compileDimensionSubProp(subProps.x);
+        compiledSubProp.values[1] = compileDimensionSubProp(subProps.y);
+        compiledSubProp.values[2] = compileDimensionSubProp(subProps.z);
+        compiledSubProp.values[3] = compileDimensionSubProp(subProps.w);
     }
 
-    return computedSubProp;
+    return compiledSubProp;
 }
 
 
 /**
- * @brief Compute the final alignment properties for this component.
+ * @brief Resolve a compiled Dimension into a pixel value.
+ *
+ * @param dimension The compiled dimension to resolve.
+ * @param reference The reference length for percentage calculations.
+ * @param maxFactor The upper clamp of the percentage fraction.
+ * @param fallback The value used for auto and invalid dimensions.
+ *
+ * @return The resolved pixel value.
  */
-SFUI::Void SFUI::Component::computeAlignment() {
-    // Children Layout Axis //
-    SFUI::String& alignDirection = baseLayout.alignDirection;
-    std::transform(alignDirection.begin(), alignDirection.end(), alignDirection.begin(), ::tolower);
-    if (alignDirection == "horizontal") computedLayout.alignDirection = SFUI::Component::AlignDirection::Horizontal;
-    else computedLayout.alignDirection = SFUI::Component::AlignDirection::Vertical;
+SFUI::Float SFUI::Component::resolveDimensionSubProp(const SFUI::CompiledProp::Dimension& dimension, SFUI::Float reference, SFUI::Float maxFactor, SFUI::Float fallback) {
+    if (dimension.unit == SFUI::CompiledProp::Unit::Absolute) return dimension.value;
+    else if (dimension.unit == SFUI::CompiledProp::Unit::Percent) return reference * std::clamp(dimension.value, 0.0f, maxFactor);
+    else return fallback;
+}
 
-    // Primary (On-Axis) Children Alignment //
-    SFUI::String& alignPrimary = baseLayout.alignPrimary;
-    std::transform(alignPrimary.begin(), alignPrimary.end(), alignPrimary.begin(), ::tolower);
-    if (alignPrimary == "end") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::End;
-    else if (alignPrimary == "center") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::Center;
-    else if (alignPrimary == "space-between") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceBetween;
-    else if (alignPrimary == "space-around") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceAround;
-    else if (alignPrimary == "space-evenly") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::SpaceEvenly;
-    else computedLayout.alignPrimary = SFUI::Component::AlignPrimary::Start;
 
-    // Secondary (Off-Axis) Children Alignment //
-    SFUI::String& alignSecondary = baseLayout.alignSecondary;
-    std::transform(alignSecondary.begin(), alignSecondary.end(), alignSecondary.begin(), ::tolower);
-    if (alignSecondary == "end") computedLayout.alignSecondary = SFUI::Component::AlignSecondary::End;
-    else if (alignSecondary == "center") computedLayout.alignSecondary = SFUI::Component::AlignSecondary::Center;
-    else computedLayout.alignSecondary = SFUI::Component::AlignSecondary::Start;
+/**
+ * @brief Resolve a compiled UniQuad into a Vector4f.
+ *
+ * Percentages are relative to the smaller side of the size and are limited to half of it.
+ *
+ * @param size The size of the component for percentage calculations.
+ * @param subProp The compiled UniQuad to resolve.
+ *
+ * @return The resolved sub-prop as a Vector4f.
+ */
+SFUI::Vector4f SFUI::Component::resolveUniQuadSubProp(const SFUI::Vector2f& size, const SFUI::CompiledProp::UniQuad& subProp) {
+    SFUI::Float subPropSizeFactor = std::min(size.x, size.y);
+    return {
+        resolveDimensionSubProp(subProp.values[0], subPropSizeFactor, 0.5f),
+        resolveDimensionSubProp(subProp.values[1], subPropSizeFactor, 0.5f),
+        resolveDimensionSubProp(subProp.values[2], subPropSizeFactor, 0.5f),
+        resolveDimensionSubProp(subProp.values[3], subPropSizeFactor, 0.5f)
+    };
+}
+
+
+/**
+ * @brief Compute the final alignment properties for this component.
+ */
+SFUI::Void SFUI::Component::computeAlignment() {
+    computedLayout.alignDirection = compiledLayout.alignDirection;
+    computedLayout.alignPrimary = compiledLayout.alignPrimary;
+    computedLayout.alignSecondary = compiledLayout.alignSecondary;
 }
 
 
@@ -303,42 +718,10 @@ SFUI::Void SFUI::Component::computeLayoutBox() {
         computedLayout.margin = {0.0f, 0.0f, 0.0f, 0.0f};
 
         // Layout Box Size //
-        computedLayout.size.x = 0.0f;
-        computedLayout.size.y = 0.0f;
-        if (std::holds_alternative<SFUI::Float>(baseLayout.width))
-            computedLayout.size.x = std::get<SFUI::Float>(baseLayout.width);
-        else if (std::holds_alternative<SFUI::String>(baseLayout.width)) {
-            SFUI::String widthString = std::get<SFUI::String>(baseLayout.width);
-            if (widthString.size() > 1 && widthString.back() == '%') {
-                widthString.pop_back();
-                try {
-                    SFUI::Size index = 0;
-                    SFUI::Double tempWidth = std::stod(widthString, &index);
-                    if (index == widthString.size())
-                        computedLayout.size.x = renderTargetSize.x * std::clamp(static_cast<SFUI::Float>(tempWidth) / 100.0f, 0.0f, 1.0f);
-                }   catch (...) {}
-            }
-            else if (widthString == "auto") {
-                computedLayout.size.x = renderTargetSize.x;
-            }
-        }
-        if (std::holds_alternative<SFUI::Float>(baseLayout.height))
-            computedLayout.size.y = std::get<SFUI::Float>(baseLayout.height);
-        else if (std::holds_alternative<SFUI::String>(baseLayout.height)) {
-            SFUI::String heightString = std::get<SFUI::String>(baseLayout.height);
-            if (heightString.size() > 1 && heightString.back() == '%') {
-                heightString.pop_back();
-                try {
-                    SFUI::Size index = 0;
-                    SFUI::Double tempHeight = std::stod(heightString, &index);
-                    if (index == heightString.size())
-                        computedLayout.size.y = renderTargetSize.y * std::clamp(static_cast<SFUI::Float>(tempHeight) / 100.0f, 0.0f, 1.0f);
-                }   catch (...) {}
-            }
-            else if (heightString == "auto") {
-                computedLayout.size.y = renderTargetSize.y;
-            }
-        }
+        if (compiledLayout.width.unit == SFUI::CompiledProp::Unit::Auto) computedLayout.size.x = renderTargetSize.x;
+        else computedLayout.size.x = resolveDimensionSubProp(compiledLayout.width, renderTargetSize.x, 1.0f);
+        if (compiledLayout.height.unit == SFUI::CompiledProp::Unit::Auto) computedLayout.size.y = renderTargetSize.y;
+        else computedLayout.size.y = resolveDimensionSubProp(compiledLayout.height, renderTargetSize.y, 1.0f);
 
         // Layout Box Position //
         computedLayout.position.x = 0.0f;
@@ -350,7 +733,7 @@ SFUI::Void SFUI::Component::computeLayoutBox() {
     }
 
     // Layout Box Padding //
-    computedLayout.padding = resolveUniQuadSubProp(computedLayout.size, baseLayout.padding);
+    computedLayout.padding = resolveUniQuadSubProp(computedLayout.size, compiledLayout.padding);
 }
 
 
@@ -359,27 +742,11 @@ SFUI::Void SFUI::Component::computeLayoutBox() {
  */
 SFUI::Void SFUI::Component::computeStyles() {
     // Border Width //
-    SFUI::Float computedBorderWidth = 0.0f;
-    if (std::holds_alternative<SFUI::Float>(baseStyle.borderWidth))
-        computedBorderWidth = std::get<SFUI::Float>(baseStyle.borderWidth);
-    else if (std::holds_alternative<SFUI::String>(baseStyle.borderWidth)) {
-        SFUI::String borderWidthString = std::get<SFUI::String>(baseStyle.borderWidth);
-        if (borderWidthString.size() > 1 && borderWidthString.back() == '%') {
-            borderWidthString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempBorderWidth = std::stod(borderWidthString, &index);
-                if (index == borderWidthString.size()) {
-                    SFUI::Float relativeBorderWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedBorderWidth = relativeBorderWidthFactor * std::clamp(static_cast<SFUI::Float>(tempBorderWidth) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
-    computedStyle.borderWidth = computedBorderWidth;
+    SFUI::Float relativeBorderWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
+    computedStyle.borderWidth = resolveDimensionSubProp(compiledStyle.borderWidth, relativeBorderWidthFactor, 0.5f);
 
     // Corner Radius //
-    computedStyle.cornerRadius = resolveUniQuadSubProp(computedLayout.size, baseStyle.cornerRadius);
+    computedStyle.cornerRadius = resolveUniQuadSubProp(computedLayout.size, compiledStyle.cornerRadius);
 }
 
 
@@ -387,126 +754,197 @@ SFUI::Void SFUI::Component::computeStyles() {
  * @brief Compute the color properties for this component.
  */
 SFUI::Void SFUI::Component::computeColors() {
-    computedStyle.fillColor = resolveColorSubProp(baseStyle.fillColor);
-    computedStyle.borderColor = resolveColorSubProp(baseStyle.borderColor);
+    computedStyle.fillColor = compiledStyle.fillColor;
+    computedStyle.borderColor = compiledStyle.borderColor;
 }
 
 
 /**
  * @brief Compute the shadow properties for this component.
+ *
+ * The radius is scaled down by the quality of the UI, which narrows the shadow ring and merges
+ * fewer layers into it. Dropped shadows are made fully transparent, so they build no geometry
+ * and add nothing to the draw bounds.
  */
 SFUI::Void SFUI::Component::computeShadows() {
+    SFUI::Float shadowScale = getShadowScale();
     computedStyle.shadowOffset = baseStyle.shadowOffset;
-    computedStyle.shadowRadius = std::clamp(baseStyle.shadowRadius, 1.0f, 20.0f);
-    computedStyle.shadowFillColor = resolveColorSubProp(baseStyle.shadowFillColor);
+    computedStyle.shadowRadius = std::clamp(baseStyle.shadowRadius * shadowScale, 1.0f, 20.0f);
+    computedStyle.shadowFillColor = shadowScale > 0.0f ? compiledStyle.shadowFillColor : SFUI::Color::Transparent;
 }
 
 
 /**
  * @brief Compute the graphical geometry for this component.
+ *
+ * The geometry is built at the origin and drawn at the component's position, so moving the
+ * component only changes its offset. Components of a UI with the same geometry inputs share a
+ * single mesh from its registry, which is only built by the first of them and freed with the last
+ * one. Components outside of a UI, or with non-finite inputs, build their own mesh.
  */
 SFUI::Void SFUI::Component::computeGraphics() {
-    backgroundRects.clear();
-    backgroundArcs.clear();
-    borderRects.clear();
-    borderArcs.clear();
-    shadowRects.clear();
-    shadowArcs.clear();
-
-    backgroundRects.setPrimitiveType(SFUI::PrimitiveType::Triangles);
-    backgroundArcs.setPrimitiveType(SFUI::PrimitiveType::Triangles);
-    borderRects.setPrimitiveType(SFUI::PrimitiveType::Triangles);
-    borderArcs.setPrimitiveType(SFUI::PrimitiveType::Triangles);
-    shadowRects.setPrimitiveType(SFUI::PrimitiveType::Triangles);
-    shadowArcs.setPrimitiveType(SFUI::PrimitiveType::Triangles);
+    SFUI::MeshRegistry::GeometryKey geometryKey = {
+        computedLayout.size,
+        computedLayout.position,
+        computedStyle.cornerRadius,
+        computedStyle.borderWidth,
+        computedStyle.fillColor,
+        computedStyle.borderColor,
+        computedStyle.shadowOffset,
+        computedStyle.shadowRadius,
+        computedStyle.shadowFillColor,
+        getArcDetail(),
+        usesShadowRings()
+    };
+    meshOffset = {static_cast<SFUI::Float>(geometryKey.position.x), static_cast<SFUI::Float>(geometryKey.position.y)};
+
+    // Keep the Mesh if Only the Position Changed //
+    if (cachedGeometryKey.has_value()) {
+        SFUI::MeshRegistry::GeometryKey translatedKey = cachedGeometryKey.value();
+        translatedKey.position = geometryKey.position;
+        if (translatedKey == geometryKey) {
+            cachedGeometryKey = geometryKey;
+            return;
+        }
+    }
+    cachedGeometryKey = geometryKey;
+
+    // Share the Mesh of Components With the Same Geometry at the Origin //
+    geometryKey.position = {0, 0};
+    SFUI::MeshRegistry* meshRegistry = updateContext ? updateContext->meshRegistry : nullptr;
+    mesh = meshRegistry ? meshRegistry->find(geometryKey) : nullptr;
+    if (!mesh) {
+        SFUI::SharedPointer<SFUI::Mesh> builtMesh = std::make_shared<SFUI::Mesh>();
+        buildGeometry(*builtMesh);
+        mesh = builtMesh;
+        if (meshRegistry) meshRegistry->insert(geometryKey, mesh);
+    }
+}
+
+
+/**
+ * @brief Get the arc level of detail of the UI the component was last updated in.
+ *
+ * @return The level of detail of the tessellated arcs, 1 outside of a UI.
+ */
+SFUI::Float SFUI::Component::getArcDetail() const {
+    return updateContext ? updateContext->arcDetail : 1.0f;
+}
+
+
+/**
+ * @brief Get the share of the shadow radius drawn by the UI the component was last updated in.
+ *
+ * @return The shadow scale, 0 if shadows are dropped, 1 outside of a UI.
+ */
+SFUI::Float SFUI::Component::getShadowScale() const {
+    return updateContext ? updateContext->shadowScale : 1.0f;
+}
+
+
+/**
+ * @brief Check if the UI the component was last updated in builds shadows as gradient rings.
+ *
+ * @return True if shadows are single gradient rings, false if they are stacked layers, true outside of a UI.
+ */
+SFUI::Bool SFUI::Component::usesShadowRings() const {
+    return updateContext ? updateContext->shadowRings : true;
+}
+
 
+/**
+ * @brief Build the shadow, background and border geometry at the origin.
+ *
+ * @param geometry The mesh to build into.
+ */
+SFUI::Void SFUI::Component::buildGeometry(SFUI::Mesh& geometry) const {
     SFUI::Float width = computedLayout.size.x;
     SFUI::Float height = computedLayout.size.y;
-    SFUI::Float left = computedLayout.position.x;
-    SFUI::Float right = computedLayout.position.x + computedLayout.size.x;
-    SFUI::Float top = computedLayout.position.y;
-    SFUI::Float bottom = computedLayout.position.y + computedLayout.size.y;
+    SFUI::Float left = 0.0f;
+    SFUI::Float right = computedLayout.size.x;
+    SFUI::Float top = 0.0f;
+    SFUI::Float bottom = computedLayout.size.y;
     SFUI::Float topLeft = computedStyle.cornerRadius.x;
     SFUI::Float topRight = computedStyle.cornerRadius.y;
     SFUI::Float bottomLeft = computedStyle.cornerRadius.z;
     SFUI::Float bottomRight = computedStyle.cornerRadius.w;
-    SFUI::Float leftInset = topLeft > bottomLeft ? topLeft : bottomLeft;
-    SFUI::Float rightInset = topRight > bottomRight ? topRight : bottomRight;
-    SFUI::Float topInset = topLeft > topRight ? topLeft : topRight;
-    SFUI::Float bottomInset = bottomLeft > bottomRight ? bottomLeft : bottomRight;
     SFUI::Float borderWidth = computedStyle.borderWidth;
     SFUI::Float shadowXOffset = computedStyle.shadowOffset.x;
     SFUI::Float shadowYOffset = computedStyle.shadowOffset.y;
     SFUI::Float shadowRadius = computedStyle.shadowRadius;
 
-    computeBackgroundRectGeometry({left + leftInset, top + topInset}, {width - leftInset - rightInset, height - topInset - bottomInset});
-    computeBackgroundRectGeometry({left, top + topLeft}, {leftInset, height - topLeft - bottomLeft});
-    computeBackgroundRectGeometry({right - rightInset, top + topRight}, {rightInset, height - topRight - bottomRight});
-    computeBackgroundRectGeometry({left + topLeft, top}, {width - topLeft - topRight, topInset});
-    computeBackgroundRectGeometry({left + bottomLeft, bottom - bottomInset}, {width - bottomLeft - bottomRight, bottomInset});
-
-    if (topLeft > 0.0f) computeBackgroundArcGeometry({left + topLeft, top + topLeft}, topLeft, 180, 270);
-    if (topRight > 0.0f) computeBackgroundArcGeometry({right - topRight, top + topRight}, topRight, 270, 360);
-    if (bottomRight > 0.0f) computeBackgroundArcGeometry({right - bottomRight, bottom - bottomRight}, bottomRight, 0, 90);
-    if (bottomLeft > 0.0f) computeBackgroundArcGeometry({left + bottomLeft, bottom - bottomLeft}, bottomLeft, 90, 180);
-
-    if (borderWidth > 0.0f)  {
-        computeBorderRectGeometry({left, top + topLeft}, {borderWidth, height - topLeft - bottomLeft});
-        computeBorderRectGeometry({right - borderWidth, top + topRight}, {borderWidth, height - topRight - bottomRight});
-        computeBorderRectGeometry({left + topLeft, top}, {width - topLeft - topRight, borderWidth});
-        computeBorderRectGeometry({left + bottomLeft, bottom - borderWidth}, {width - bottomLeft - bottomRight, borderWidth});
-
-        if (topLeft > 0.0f) computeBorderArcGeometry({left + topLeft, top + topLeft}, topLeft, topLeft >= borderWidth ? topLeft - borderWidth : 0.0f, 180, 270);
-        if (topRight > 0.0f) computeBorderArcGeometry({right - topRight, top + topRight}, topRight, topRight >= borderWidth ? topRight - borderWidth : 0.0f, 270, 360);
-        if (bottomRight > 0.0f) computeBorderArcGeometry({right - bottomRight, bottom - bottomRight}, bottomRight, bottomRight >= borderWidth ? bottomRight - borderWidth : 0.0f, 0, 90);
-        if (bottomLeft > 0.0f) computeBorderArcGeometry({left + bottomLeft, bottom - bottomLeft}, bottomLeft, bottomLeft >= borderWidth ? bottomLeft - borderWidth : 0.0f, 90, 180);
+    if (static_cast<int>(computedStyle.shadowFillColor.a) > 0 && !usesShadowRings()) {
+        computeShadowLayersGeometry(geometry, {shadowXOffset, shadowYOffset}, computedLayout.size, computedStyle.cornerRadius, std::max(1, static_cast<SFUI::Int>(std::ceil(shadowRadius))));
+    }   else if (static_cast<int>(computedStyle.shadowFillColor.a) > 0) {
+        // Composite Alpha of the Stacked Shadow Layers the Ring Replaces //
+        SFUI::Int shadowLayers = std::max(1, static_cast<SFUI::Int>(std::ceil(shadowRadius)));
+        SFUI::Float perLayerPosInset = 2.0f;
+        SFUI::Float transparency = 1.0f;
+        for (SFUI::Int i = 0; i < shadowLayers; i++) {
+            SFUI::Float alphaFactor = shadowLayers > 1 ? static_cast<SFUI::Float>(i) / (shadowLayers - 1) : 0.0f;
+            transparency *= 1.0f - (computedStyle.shadowFillColor.a / 255.0f) * (1.0f - alphaFactor * alphaFactor);
+        }
+        SFUI::Color innerShadowColor = computedStyle.shadowFillColor;
+        innerShadowColor.a = static_cast<std::uint8_t>(255.0f * (1.0f - transparency));
+
+        computeShadowRingGeometry(
+            geometry,
+            {shadowXOffset, shadowYOffset},
+            computedLayout.size,
+            computedStyle.cornerRadius,
+            perLayerPosInset * (shadowLayers - 1),
+            computedStyle.shadowFillColor,
+            innerShadowColor
+        );
+    }
+
+    // An Opaque Border Hides the Background Beneath It, so the Background Only Fills the Inner Contour of the Border //
+    SFUI::Float backgroundInset = (borderWidth > 0.0f && computedStyle.borderColor.a == 255) ? borderWidth : 0.0f;
+    SFUI::Float backgroundWidth = width - 2.0f * backgroundInset;
+    SFUI::Float backgroundHeight = height - 2.0f * backgroundInset;
+    // Fully Transparent Geometry is Skipped, so Its Empty Mesh Does Not Split the Batch Around Text //
+    if (backgroundWidth > 0.0f && backgroundHeight > 0.0f && computedStyle.fillColor.a > 0) {
+        SFUI::Float backgroundLeft = left + backgroundInset;
+        SFUI::Float backgroundRight = right - backgroundInset;
+        SFUI::Float backgroundTop = top + backgroundInset;
+        SFUI::Float backgroundBottom = bottom - backgroundInset;
+        SFUI::Float backgroundTopLeft = std::max(topLeft - backgroundInset, 0.0f);
+        SFUI::Float backgroundTopRight = std::max(topRight - backgroundInset, 0.0f);
+        SFUI::Float backgroundBottomLeft = std::max(bottomLeft - backgroundInset, 0.0f);
+        SFUI::Float backgroundBottomRight = std::max(bottomRight - backgroundInset, 0.0f);
+        SFUI::Float leftInset = std::max(backgroundTopLeft, backgroundBottomLeft);
+        SFUI::Float rightInset = std::max(backgroundTopRight, backgroundBottomRight);
+        SFUI::Float topInset = std::max(backgroundTopLeft, backgroundTopRight);
+        SFUI::Float bottomInset = std::max(backgroundBottomLeft, backgroundBottomRight);
+
+        computeBackgroundRectGeometry(geometry, {backgroundLeft + leftInset, backgroundTop + topInset}, {backgroundWidth - leftInset - rightInset, backgroundHeight - topInset - bottomInset});
+        computeBackgroundRectGeometry(geometry, {backgroundLeft, backgroundTop + backgroundTopLeft}, {leftInset, backgroundHeight - backgroundTopLeft - backgroundBottomLeft});
+        computeBackgroundRectGeometry(geometry, {backgroundRight - rightInset, backgroundTop + backgroundTopRight}, {rightInset, backgroundHeight - backgroundTopRight - backgroundBottomRight});
+        computeBackgroundRectGeometry(geometry, {backgroundLeft + backgroundTopLeft, backgroundTop}, {backgroundWidth - backgroundTopLeft - backgroundTopRight, topInset});
+        computeBackgroundRectGeometry(geometry, {backgroundLeft + backgroundBottomLeft, backgroundBottom - bottomInset}, {backgroundWidth - backgroundBottomLeft - backgroundBottomRight, bottomInset});
+
+        // Arcs Use the Resolution of the Border's Outer Radius, so They Share the Vertices of the Border's Inner Contour //
+        if (backgroundTopLeft > 0.0f) computeBackgroundArcGeometry(geometry, {left + topLeft, top + topLeft}, backgroundTopLeft, 180, SFUI::ArcTessellator::getResolution(topLeft, getArcDetail()));
+        if (backgroundTopRight > 0.0f) computeBackgroundArcGeometry(geometry, {right - topRight, top + topRight}, backgroundTopRight, 270, SFUI::ArcTessellator::getResolution(topRight, getArcDetail()));
+        if (backgroundBottomRight > 0.0f) computeBackgroundArcGeometry(geometry, {right - bottomRight, bottom - bottomRight}, backgroundBottomRight, 0, SFUI::ArcTessellator::getResolution(bottomRight, getArcDetail()));
+        if (backgroundBottomLeft > 0.0f) computeBackgroundArcGeometry(geometry, {left + bottomLeft, bottom - bottomLeft}, backgroundBottomLeft, 90, SFUI::ArcTessellator::getResolution(bottomLeft, getArcDetail()));
     }
 
-    if (static_cast<int>(computedStyle.shadowFillColor.a) > 0) {
-        SFUI::Float shadowLayers = shadowRadius;
-        SFUI::Vector2f startingSize = computedLayout.size;
-        SFUI::Vector2f startingPos = {computedLayout.position.x + shadowXOffset, computedLayout.position.y + shadowYOffset};
-        SFUI::Vector4f startingRadii = computedStyle.cornerRadius;
-        // SFUI::Float perLayerSizeInset = std::clamp(shadowLayers / 2.5f, 2.0f, 10.0f);
-        SFUI::Float perLayerSizeInset = 4.0f;
-        SFUI::Float perLayerPosInset = perLayerSizeInset / 2;
-
-        for (int i = 0; i < shadowLayers; i++) {
-            SFUI::Color layerColor = computedStyle.shadowFillColor;
-            SFUI::Float alphaFactor = static_cast<float>(i) / (shadowLayers - 1);
-            SFUI::Float layerAlpha = computedStyle.shadowFillColor.a * (1.0f - alphaFactor * alphaFactor);
-            layerColor.a = static_cast<std::uint8_t>(layerAlpha);
-
-            SFUI::Float width = startingSize.x - (perLayerSizeInset * i);
-            SFUI::Float height = startingSize.y - (perLayerSizeInset * i);
-            SFUI::Float left = startingPos.x + (perLayerPosInset * i);
-            SFUI::Float right = startingPos.x + (perLayerPosInset * i) + width;
-            SFUI::Float top = startingPos.y + (perLayerPosInset * i);
-            SFUI::Float bottom = startingPos.y + (perLayerPosInset * i) + height;
-            SFUI::Float topLeft = std::max(0.0f, startingRadii.x - (perLayerSizeInset * i));
-            SFUI::Float topRight = std::max(0.0f, startingRadii.y - (perLayerSizeInset * i));
-            SFUI::Float bottomLeft = std::max(0.0f, startingRadii.z - (perLayerSizeInset * i));
-            SFUI::Float bottomRight = std::max(0.0f, startingRadii.w - (perLayerSizeInset * i));
-            SFUI::Float leftInset = topLeft > bottomLeft ? topLeft : bottomLeft;
-            SFUI::Float rightInset = topRight > bottomRight ? topRight : bottomRight;
-            SFUI::Float topInset = topLeft > topRight ? topLeft : topRight;
-            SFUI::Float bottomInset = bottomLeft > bottomRight ? bottomLeft : bottomRight;
-
-            computeShadowRectGeometry({left + leftInset, top + topInset}, {width - leftInset - rightInset, height - topInset - bottomInset}, layerColor);
-            computeShadowRectGeometry({left, top + topLeft}, {leftInset, height - topLeft - bottomLeft}, layerColor);
-            computeShadowRectGeometry({right - rightInset, top + topRight}, {rightInset, height - topRight - bottomRight}, layerColor);
-            computeShadowRectGeometry({left + topLeft, top}, {width - topLeft - topRight, topInset}, layerColor);
-            computeShadowRectGeometry({left + bottomLeft, bottom - bottomInset}, {width - bottomLeft - bottomRight, bottomInset}, layerColor);
-
-            if (topLeft > 0.0f) computeShadowArcGeometry({left + topLeft, top + topLeft}, topLeft, 180, 270, layerColor);
-            if (topRight > 0.0f) computeShadowArcGeometry({right - topRight, top + topRight}, topRight, 270, 360, layerColor);
-            if (bottomRight > 0.0f) computeShadowArcGeometry({right - bottomRight, bottom - bottomRight}, bottomRight, 0, 90, layerColor);
-            if (bottomLeft > 0.0f) computeShadowArcGeometry({left + bottomLeft, bottom - bottomLeft}, bottomLeft, 90, 180, layerColor);
-        }
+    if (borderWidth > 0.0f && computedStyle.borderColor.a > 0)  {
+        computeBorderRectGeometry(geometry, {left, top + topLeft}, {borderWidth, height - topLeft - bottomLeft});
+        computeBorderRectGeometry(geometry, {right - borderWidth, top + topRight}, {borderWidth, height - topRight - bottomRight});
+        computeBorderRectGeometry(geometry, {left + topLeft, top}, {width - topLeft - topRight, borderWidth});
+        computeBorderRectGeometry(geometry, {left + bottomLeft, bottom - borderWidth}, {width - bottomLeft - bottomRight, borderWidth});
+
+        if (topLeft > 0.0f) computeBorderArcGeometry(geometry, {left + topLeft, top + topLeft}, topLeft, topLeft >= borderWidth ? topLeft - borderWidth : 0.0f, 180);
+        if (topRight > 0.0f) computeBorderArcGeometry(geometry, {right - topRight, top + topRight}, topRight, topRight >= borderWidth ? topRight - borderWidth : 0.0f, 270);
+        if (bottomRight > 0.0f) computeBorderArcGeometry(geometry, {right - bottomRight, bottom - bottomRight}, bottomRight, bottomRight >= borderWidth ? bottomRight - borderWidth : 0.0f, 0);
+        if (bottomLeft > 0.0f) computeBorderArcGeometry(geometry, {left + bottomLeft, bottom - bottomLeft}, bottomLeft, bottomLeft >= borderWidth ? bottomLeft - borderWidth : 0.0f, 90);
     }
 }
 
 
+
 /**
  * @brief Compute the magrgin, size, and position for all child components.
  */
@@ -517,7 +955,7 @@ SFUI::Void SFUI::Component::computeChildrenLayoutBox() {
         // Children Layout Box Margins //
         for (int i = 0; i < children.size(); i++) {
             SFUI::Component& childComponent = *children[i];
-            computedChildrenLayout[i].margin = resolveUniQuadSubProp(computedLayout.size, childComponent.baseLayout.margin);
+            computedChildrenLayout[i].margin = resolveUniQuadSubProp(computedLayout.size, childComponent.compiledLayout.margin);
         }
 
 
@@ -533,43 +971,25 @@ SFUI::Void SFUI::Component::computeChildrenLayoutBox() {
             SFUI::Vector2f computedSize = {0.0f, 0.0f};
             SFUI::Component& childComponent = *children[i];
             // Width //
-            if (std::holds_alternative<SFUI::Float>(childComponent.baseLayout.width))
-                computedSize.x = std::get<SFUI::Float>(childComponent.baseLayout.width);
-            else if (std::holds_alternative<SFUI::String>(childComponent.baseLayout.width)) {
-                SFUI::String widthString = std::get<SFUI::String>(childComponent.baseLayout.width);
-                if (widthString.size() > 1 && widthString.back() == '%') {
-                    widthString.pop_back();
-                    try {
-                        size_t index = 0;
-                        SFUI::Double tempWidth = std::stod(widthString, &index);
-                        if (index == widthString.size())
-                            computedSize.x = (
-                                availableSize.x * std::clamp(static_cast<SFUI::Float>(tempWidth) / 100.0f, 0.0f, 1.0f) -
-                                (computedChildrenLayout[i].margin.x + computedChildrenLayout[i].margin.y)
-                            );
-                    }   catch (...) {}
-                }
-                else if (widthString == "auto") ++autoSizedWidthChildren;
-            }
+            const SFUI::CompiledProp::Dimension& childWidth = childComponent.compiledLayout.width;
+            if (childWidth.unit == SFUI::CompiledProp::Unit::Absolute)
+                computedSize.x = childWidth.value;
+            else if (childWidth.unit == SFUI::CompiledProp::Unit::Percent)
+                computedSize.x = (
+                    availableSize.x * std::clamp(childWidth.value, 0.0f, 1.0f) -
+                    (computedChildrenLayout[i].margin.x + computedChildrenLayout[i].margin.y)
+                );
+            else if (childWidth.unit == SFUI::CompiledProp::Unit::Auto) ++autoSizedWidthChildren;
             // Height //
-            if (std::holds_alternative<SFUI::Float>(childComponent.baseLayout.height))
-                computedSize.y = std::get<SFUI::Float>(childComponent.baseLayout.height);
-            else if (std::holds_alternative<SFUI::String>(childComponent.baseLayout.height)) {
-                SFUI::String heightString = std::get<SFUI::String>(childComponent.baseLayout.height);
-                if (heightString.size() > 1 && heightString.back() == '%') {
-                    heightString.pop_back();
-                    try {
-                        size_t index = 0;
-                        SFUI::Double tempHeight = std::stod(heightString, &index);
-                        if (index == heightString.size())
-                            computedSize.y = (
-                                availableSize.y * (static_cast<SFUI::Float>(tempHeight) / 100.0f) -
-                                (computedChildrenLayout[i].margin.z + computedChildrenLayout[i].margin.w)
-                            );
-                    }   catch (...) {}
-                }
-                else if (heightString == "auto") ++autoSizedHeightChildren;
-            }
+            const SFUI::CompiledProp::Dimension& childHeight = childComponent.compiledLayout.height;
+            if (childHeight.unit == SFUI::CompiledProp::Unit::Absolute)
+                computedSize.y = childHeight.value;
+            else if (childHeight.unit == SFUI::CompiledProp::Unit::Percent)
+                computedSize.y = (
+                    availableSize.y * childHeight.value -
+                    (computedChildrenLayout[i].margin.z + computedChildrenLayout[i].margin.w)
+                );
+            else if (childHeight.unit == SFUI::CompiledProp::Unit::Auto) ++autoSizedHeightChildren;
             usedSize = {usedSize.x + computedSize.x, usedSize.y + computedSize.y};
             computedChildrenLayout[i].size = {computedSize.x, computedSize.y};
         }
@@ -581,12 +1001,10 @@ SFUI::Void SFUI::Component::computeChildrenLayoutBox() {
             autoAvailableSize.y = std::max(0.0f, (availableSize.y - usedSize.y) / static_cast<SFUI::Float>(autoSizedHeightChildren));
         for (int i = 0; i < children.size(); i++) {
             SFUI::Component& childComponent = *children[i];
-            if (std::holds_alternative<SFUI::String>(childComponent.baseLayout.width) &&
-                std::get<SFUI::String>(childComponent.baseLayout.width) == "auto") {
+            if (childComponent.compiledLayout.width.unit == SFUI::CompiledProp::Unit::Auto) {
                 computedChildrenLayout[i].size.x = std::round(autoAvailableSize.x) - (computedChildrenLayout[i].margin.x + computedChildrenLayout[i].margin.y);
             }
-            if (std::holds_alternative<SFUI::String>(childComponent.baseLayout.height) &&
-                std::get<SFUI::String>(childComponent.baseLayout.height) == "auto") {
+            if (childComponent.compiledLayout.height.unit == SFUI::CompiledProp::Unit::Auto) {
                 computedChildrenLayout[i].size.y = std::round(autoAvailableSize.y) - (computedChildrenLayout[i].margin.z + computedChildrenLayout[i].margin.w);
             }
         }
@@ -594,7 +1012,6 @@ SFUI::Void SFUI::Component::computeChildrenLayoutBox() {
 
         // Children Layout Box Position //
         // Calculate Each Component's Sizing and Margins and Total Sizing with Margins Combined //
-        SFUI::Vector<SFUI::Float> componentSizeAndMargins;
         SFUI::Float totalComponentSizingAndMargins = 0.0f;
         SFUI::Float availableGapSize = 0.0f;
         SFUI::Float gapSize = 0.0f;
@@ -606,7 +1023,6 @@ SFUI::Void SFUI::Component::computeChildrenLayoutBox() {
                 childTotalSize = computedChildrenLayout[i].size.y + (computedChildrenLayout[i].margin.z + computedChildrenLayout[i].margin.w);
             else if (computedLayout.alignDirection == SFUI::Component::AlignDirection::Horizontal)
                 childTotalSize = computedChildrenLayout[i].size.x + (computedChildrenLayout[i].margin.x + computedChildrenLayout[i].margin.y);
-            componentSizeAndMargins.push_back(childTotalSize);
             totalComponentSizingAndMargins += childTotalSize;
         }
 
@@ -744,46 +1160,35 @@ SFUI::Void SFUI::Component::updateChildren() {
 /**
  * @brief Compute a box (two triangles).
  *
+ * @param geometry The mesh to add to.
  * @param position The top-left position of the box to draw at.
  * @param size The size of the box to draw.
  */
-SFUI::Void SFUI::Component::computeBackgroundRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size) {
-    SFUI::Vector2f topLeft = position;
-    SFUI::Vector2f topRight = {position.x + size.x, position.y};
-    SFUI::Vector2f bottomLeft = {position.x, position.y + size.y};
-    SFUI::Vector2f bottomRight = {position.x + size.x, position.y + size.y};
-    backgroundRects.append({topLeft, computedStyle.fillColor});
-    backgroundRects.append({topRight, computedStyle.fillColor});
-    backgroundRects.append({bottomRight, computedStyle.fillColor});
-    backgroundRects.append({topLeft, computedStyle.fillColor});
-    backgroundRects.append({bottomRight, computedStyle.fillColor});
-    backgroundRects.append({bottomLeft, computedStyle.fillColor});
+SFUI::Void SFUI::Component::computeBackgroundRectGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size) const {
+    geometry.addRect(position, size, computedStyle.fillColor);
 }
 
 
 /**
- * @brief Compute a circular arc (triangle fan) .
+ * @brief Compute a quarter-circle arc (triangle fan).
  *
+ * @param geometry The mesh to add to.
  * @param center The center position of the arc.
  * @param outerRadius The outer radius of the arc.
- * @param startAngleDeg The starting angle of the arc in degrees.
- * @param endAngleDeg The ending angle of the arc in degrees.
- */
-SFUI::Void SFUI::Component::computeBackgroundArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg) {
-    SFUI::Float arcResolution = std::clamp(static_cast<SFUI::Int>(outerRadius * 0.25f), 4, 12);
-    SFUI::Float startRadians = startAngleDeg * M_PI / 180.f;
-    SFUI::Float endRadians = endAngleDeg * M_PI / 180.f;
-    SFUI::Float angleStep = (endRadians - startRadians) / static_cast<SFUI::Float>(arcResolution);
-
-    for (SFUI::Int i = 0; i < arcResolution; ++i) {
-        SFUI::Float angle0 = startRadians + i * angleStep;
-        SFUI::Float angle1 = startRadians + (i + 1) * angleStep;
-        SFUI::Vector2f outer0(center.x + std::cos(angle0) * outerRadius, center.y + std::sin(angle0) * outerRadius);
-        SFUI::Vector2f outer1(center.x + std::cos(angle1) * outerRadius, center.y + std::sin(angle1) * outerRadius);
-        SFUI::Vector2f inner(center);
-        backgroundArcs.append({outer0, computedStyle.fillColor});
-        backgroundArcs.append({outer1, computedStyle.fillColor});
-        backgroundArcs.append({inner, computedStyle.fillColor});
+ * @param startAngleDeg The starting angle of the arc in degrees, the arc ending 90 degrees later.
+ * @param arcResolution The number of segments of the arc.
+ */
+SFUI::Void SFUI::Component::computeBackgroundArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Int arcResolution) const {
+    SFUI::Float outerX[SFUI::ArcTessellator::maxPointCount];
+    SFUI::Float outerY[SFUI::ArcTessellator::maxPointCount];
+    SFUI::ArcTessellator::tessellate(center, outerRadius, startAngleDeg, arcResolution, outerX, outerY);
+
+    SFUI::Mesh::Index centerIndex = geometry.addVertex(center, computedStyle.fillColor);
+    SFUI::Mesh::Index previousIndex = geometry.addVertex({outerX[0], outerY[0]}, computedStyle.fillColor);
+    for (SFUI::Int i = 1; i <= arcResolution; ++i) {
+        SFUI::Mesh::Index outerIndex = geometry.addVertex({outerX[i], outerY[i]}, computedStyle.fillColor);
+        geometry.addTriangle(previousIndex, outerIndex, centerIndex);
+        previousIndex = outerIndex;
     }
 }
 
@@ -791,99 +1196,204 @@ SFUI::Void SFUI::Component::computeBackgroundArcGeometry(SFUI::Vector2f center,
 /**
  * @brief Compute a box (two triangles).
  *
+ * @param geometry The mesh to add to.
  * @param position The top-left position of the box to draw at.
  * @param size The size of the box to draw.
  */
-SFUI::Void SFUI::Component::computeBorderRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size) {
-    SFUI::Vector2f topLeft = position;
-    SFUI::Vector2f topRight = {position.x + size.x, position.y};
-    SFUI::Vector2f bottomLeft = {position.x, position.y + size.y};
-    SFUI::Vector2f bottomRight = {position.x + size.x, position.y + size.y};
-    borderRects.append({topLeft, computedStyle.borderColor});
-    borderRects.append({topRight, computedStyle.borderColor});
-    borderRects.append({bottomRight, computedStyle.borderColor});
-    borderRects.append({topLeft, computedStyle.borderColor});
-    borderRects.append({bottomRight, computedStyle.borderColor});
-    borderRects.append({bottomLeft, computedStyle.borderColor});
+SFUI::Void SFUI::Component::computeBorderRectGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size) const {
+    geometry.addRect(position, size, computedStyle.borderColor);
 }
 
 
 /**
- * @brief Compute a circular arc (triangle strip).
+ * @brief Compute a quarter-circle arc ring (triangle strip).
  *
+ * @param geometry The mesh to add to.
  * @param center The center position of the arc.
  * @param outerRadius The outer radius of the arc.
  * @param innerRadius The inner radius of the arc.
- * @param startAngleDeg The starting angle of the arc in degrees.
- * @param endAngleDeg The ending angle of the arc in degrees.
- */
-SFUI::Void SFUI::Component::computeBorderArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float innerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg) {
-    SFUI::Float arcResolution = std::clamp(static_cast<SFUI::Int>(outerRadius * 0.25f), 4, 12);
-    SFUI::Float startRadians = startAngleDeg * M_PI / 180.f;
-    SFUI::Float endRadians = endAngleDeg * M_PI / 180.f;
-    SFUI::Float angleStep = (endRadians - startRadians) / static_cast<SFUI::Float>(arcResolution);
-
-    for (SFUI::Int i = 0; i < arcResolution; ++i) {
-        SFUI::Float angle0 = startRadians + i * angleStep;
-        SFUI::Float angle1 = startRadians + (i + 1) * angleStep;
-        SFUI::Vector2f outer0(center.x + std::cos(angle0) * outerRadius, center.y + std::sin(angle0) * outerRadius);
-        SFUI::Vector2f outer1(center.x + std::cos(angle1) * outerRadius, center.y + std::sin(angle1) * outerRadius);
-        SFUI::Vector2f inner0(center.x + std::cos(angle0) * innerRadius, center.y + std::sin(angle0) * innerRadius);
-        SFUI::Vector2f inner1(center.x + std::cos(angle1) * innerRadius, center.y + std::sin(angle1) * innerRadius);
-        borderArcs.append({outer0, computedStyle.borderColor});
-        borderArcs.append({outer1, computedStyle.borderColor});
-        borderArcs.append({inner0, computedStyle.borderColor});
-        borderArcs.append({inner0, computedStyle.borderColor});
-        borderArcs.append({outer1, computedStyle.borderColor});
-        borderArcs.append({inner1, computedStyle.borderColor});
+ * @param startAngleDeg The starting angle of the arc in degrees, the arc ending 90 degrees later.
+ */
+SFUI::Void SFUI::Component::computeBorderArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float innerRadius, SFUI::Float startAngleDeg) const {
+    SFUI::Int arcResolution = SFUI::ArcTessellator::getResolution(outerRadius, getArcDetail());
+    SFUI::Float outerX[SFUI::ArcTessellator::maxPointCount];
+    SFUI::Float outerY[SFUI::ArcTessellator::maxPointCount];
+    SFUI::Float innerX[SFUI::ArcTessellator::maxPointCount];
+    SFUI::Float innerY[SFUI::ArcTessellator::maxPointCount];
+    SFUI::ArcTessellator::tessellate(center, outerRadius, startAngleDeg, arcResolution, outerX, outerY);
+    SFUI::ArcTessellator::tessellate(center, innerRadius, startAngleDeg, arcResolution, innerX, innerY);
+
+    SFUI::Mesh::Index outer0 = geometry.addVertex({outerX[0], outerY[0]}, computedStyle.borderColor);
+    SFUI::Mesh::Index inner0 = geometry.addVertex({innerX[0], innerY[0]}, computedStyle.borderColor);
+    for (SFUI::Int i = 1; i <= arcResolution; ++i) {
+        SFUI::Mesh::Index outer1 = geometry.addVertex({outerX[i], outerY[i]}, computedStyle.borderColor);
+        SFUI::Mesh::Index inner1 = geometry.addVertex({innerX[i], innerY[i]}, computedStyle.borderColor);
+        geometry.addTriangle(outer0, outer1, inner0);
+        geometry.addTriangle(inner0, outer1, inner1);
+        outer0 = outer1;
+        inner0 = inner1;
     }
 }
 
 
 /**
- * @brief Compute a shadow box (two triangles).
+ * @brief Compute the shadow as a single rounded-rect ring mesh with an alpha gradient.
  *
- * @param position The top-left position of the box to draw at.
- * @param size The size of the box to draw.
- * @param modifiedShadowColor The modified shadow color for this layer.
+ * The ring runs from the outer contour, at the outer color, to a contour inset by the spread,
+ * at the inner color, and the inner contour is filled with the inner color. The vertex count
+ * only depends on the corner radii, never on the spread. Every contour point is a single mesh
+ * vertex shared by the ring quads around it.
+ *
+ * @param geometry The mesh to add to.
+ * @param position The top-left position of the outer contour.
+ * @param size The size of the outer contour.
+ * @param cornerRadius The corner radii of the outer contour.
+ * @param spread The inset of the inner contour, where the gradient ends.
+ * @param outerColor The shadow color at the outer contour.
+ * @param innerColor The shadow color at and inside the inner contour.
  */
-SFUI::Void SFUI::Component::computeShadowRectGeometry(SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Color modifiedShadowColor) {
-    SFUI::Vector2f topLeft = position;
-    SFUI::Vector2f topRight = {position.x + size.x, position.y};
-    SFUI::Vector2f bottomLeft = {position.x, position.y + size.y};
-    SFUI::Vector2f bottomRight = {position.x + size.x, position.y + size.y};
-    shadowRects.append({topLeft, modifiedShadowColor});
-    shadowRects.append({topRight, modifiedShadowColor});
-    shadowRects.append({bottomRight, modifiedShadowColor});
-    shadowRects.append({topLeft, modifiedShadowColor});
-    shadowRects.append({bottomRight, modifiedShadowColor});
-    shadowRects.append({bottomLeft, modifiedShadowColor});
+SFUI::Void SFUI::Component::computeShadowRingGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Vector4f cornerRadius, SFUI::Float spread, SFUI::Color outerColor, SFUI::Color innerColor) const {
+    spread = std::clamp(spread, 0.0f, std::min(size.x, size.y) / 2.0f);
+    SFUI::Float left = position.x;
+    SFUI::Float top = position.y;
+    SFUI::Float right = position.x + size.x;
+    SFUI::Float bottom = position.y + size.y;
+
+    // Corners in Contour Order: Top-Left, Top-Right, Bottom-Right, Bottom-Left //
+    const SFUI::Float cornerRadii[4] = {cornerRadius.x, cornerRadius.y, cornerRadius.w, cornerRadius.z};
+    const SFUI::Float cornerStartAngles[4] = {180.0f, 270.0f, 0.0f, 90.0f};
+    const SFUI::Float cornerSignX[4] = {1.0f, -1.0f, -1.0f, 1.0f};
+    const SFUI::Float cornerSignY[4] = {1.0f, 1.0f, -1.0f, -1.0f};
+    const SFUI::Vector2f cornerPoints[4] = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+
+    // Each Corner Adds at Most One Tessellated Quarter Circle to the Contours //
+    SFUI::Vector2f outerContour[4 * SFUI::ArcTessellator::maxPointCount];
+    SFUI::Vector2f innerContour[4 * SFUI::ArcTessellator::maxPointCount];
+    SFUI::Size contourSize = 0;
+    for (SFUI::Int corner = 0; corner < 4; corner++) {
+        SFUI::Float outerRadius = cornerRadii[corner];
+        SFUI::Float innerRadius = std::max(0.0f, outerRadius - 2.0f * spread);
+        SFUI::Vector2f outerCenter(cornerPoints[corner].x + cornerSignX[corner] * outerRadius, cornerPoints[corner].y + cornerSignY[corner] * outerRadius);
+        SFUI::Vector2f innerCenter(cornerPoints[corner].x + cornerSignX[corner] * (spread + innerRadius), cornerPoints[corner].y + cornerSignY[corner] * (spread + innerRadius));
+        if (outerRadius <= 0.0f) {
+            outerContour[contourSize] = cornerPoints[corner];
+            innerContour[contourSize] = innerCenter;
+            contourSize++;
+            continue;
+        }
+
+        SFUI::Int arcResolution = SFUI::ArcTessellator::getResolution(outerRadius, getArcDetail());
+        SFUI::Float outerX[SFUI::ArcTessellator::maxPointCount];
+        SFUI::Float outerY[SFUI::ArcTessellator::maxPointCount];
+        SFUI::Float innerX[SFUI::ArcTessellator::maxPointCount];
+        SFUI::Float innerY[SFUI::ArcTessellator::maxPointCount];
+        SFUI::ArcTessellator::tessellate(outerCenter, outerRadius, cornerStartAngles[corner], arcResolution, outerX, outerY);
+        SFUI::ArcTessellator::tessellate(innerCenter, innerRadius, cornerStartAngles[corner], arcResolution, innerX, innerY);
+        for (SFUI::Int i = 0; i <= arcResolution; i++) {
+            outerContour[contourSize] = {outerX[i], outerY[i]};
+            innerContour[contourSize] = {innerX[i], innerY[i]};
+            contourSize++;
+        }
+    }
+
+    // Gradient Ring Between the Outer and Inner Contours //
+    SFUI::Mesh::Index firstIndex = static_cast<SFUI::Mesh::Index>(geometry.getVertices().size());
+    for (SFUI::Size i = 0; i < contourSize; i++) {
+        geometry.addVertex(outerContour[i], outerColor);
+        geometry.addVertex(innerContour[i], innerColor);
+    }
+    for (SFUI::Size i = 0; i < contourSize; i++) {
+        SFUI::Size next = (i + 1) % contourSize;
+        SFUI::Mesh::Index outer0 = firstIndex + 2 * i;
+        SFUI::Mesh::Index inner0 = outer0 + 1;
+        SFUI::Mesh::Index outer1 = firstIndex + 2 * next;
+        SFUI::Mesh::Index inner1 = outer1 + 1;
+        geometry.addTriangle(outer0, outer1, inner1);
+        geometry.addTriangle(outer0, inner1, inner0);
+    }
+
+    // Solid Fill Inside the Inner Contour //
+    if (size.x - 2.0f * spread <= 0.0f || size.y - 2.0f * spread <= 0.0f) return;
+    SFUI::Mesh::Index centerIndex = geometry.addVertex({(left + right) / 2.0f, (top + bottom) / 2.0f}, innerColor);
+    for (SFUI::Size i = 0; i < contourSize; i++) {
+        SFUI::Size next = (i + 1) % contourSize;
+        geometry.addTriangle(centerIndex, firstIndex + 2 * i + 1, firstIndex + 2 * next + 1);
+    }
 }
 
 
 /**
- * @brief Compute a shadow circular arc (triangle fan).
+ * @brief Compute the shadow as stacked rounded-rect layers, each inset from the last with its own alpha.
+ *
+ * Each layer is inset by 2 on every side from the previous one and made of five rects and four
+ * corner arcs, so the vertex count grows with the layer count. The alpha of the layers falls off
+ * quadratically from the shadow color's alpha on the largest layer to none on the smallest one.
  *
+ * @param geometry The mesh to add to.
+ * @param position The top-left position of the largest layer.
+ * @param size The size of the largest layer.
+ * @param cornerRadius The corner radii of the largest layer.
+ * @param shadowLayers The number of layers.
+ */
+SFUI::Void SFUI::Component::computeShadowLayersGeometry(SFUI::Mesh& geometry, SFUI::Vector2f position, SFUI::Vector2f size, SFUI::Vector4f cornerRadius, SFUI::Int shadowLayers) const {
+    SFUI::Float perLayerSizeInset = 4.0f;
+    SFUI::Float perLayerPosInset = perLayerSizeInset / 2;
+
+    for (SFUI::Int i = 0; i < shadowLayers; i++) {
+        SFUI::Color layerColor = computedStyle.shadowFillColor;
+        SFUI::Float alphaFactor = shadowLayers > 1 ? static_cast<SFUI::Float>(i) / (shadowLayers - 1) : 0.0f;
+        layerColor.a = static_cast<std::uint8_t>(computedStyle.shadowFillColor.a * (1.0f - alphaFactor * alphaFactor));
+
+        SFUI::Float width = size.x - (perLayerSizeInset * i);
+        SFUI::Float height = size.y - (perLayerSizeInset * i);
+        if (width <= 0.0f || height <= 0.0f) return;
+        SFUI::Float left = position.x + (perLayerPosInset * i);
+        SFUI::Float right = left + width;
+        SFUI::Float top = position.y + (perLayerPosInset * i);
+        SFUI::Float bottom = top + height;
+        SFUI::Float topLeft = std::max(0.0f, cornerRadius.x - (perLayerSizeInset * i));
+        SFUI::Float topRight = std::max(0.0f, cornerRadius.y - (perLayerSizeInset * i));
+        SFUI::Float bottomLeft = std::max(0.0f, cornerRadius.z - (perLayerSizeInset * i));
+        SFUI::Float bottomRight = std::max(0.0f, cornerRadius.w - (perLayerSizeInset * i));
+        SFUI::Float leftInset = std::max(topLeft, bottomLeft);
+        SFUI::Float rightInset = std::max(topRight, bottomRight);
+        SFUI::Float topInset = std::max(topLeft, topRight);
+        SFUI::Float bottomInset = std::max(bottomLeft, bottomRight);
+
+        geometry.addRect({left + leftInset, top + topInset}, {width - leftInset - rightInset, height - topInset - bottomInset}, layerColor);
+        geometry.addRect({left, top + topLeft}, {leftInset, height - topLeft - bottomLeft}, layerColor);
+        geometry.addRect({right - rightInset, top + topRight}, {rightInset, height - topRight - bottomRight}, layerColor);
+        geometry.addRect({left + topLeft, top}, {width - topLeft - topRight, topInset}, layerColor);
+        geometry.addRect({left + bottomLeft, bottom - bottomInset}, {width - bottomLeft - bottomRight, bottomInset}, layerColor);
+
+        if (topLeft > 0.0f) computeShadowArcGeometry(geometry, {left + topLeft, top + topLeft}, topLeft, 180, layerColor);
+        if (topRight > 0.0f) computeShadowArcGeometry(geometry, {right - topRight, top + topRight}, topRight, 270, layerColor);
+        if (bottomRight > 0.0f) computeShadowArcGeometry(geometry, {right - bottomRight, bottom - bottomRight}, bottomRight, 0, layerColor);
+        if (bottomLeft > 0.0f) computeShadowArcGeometry(geometry, {left + bottomLeft, bottom - bottomLeft}, bottomLeft, 90, layerColor);
+    }
+}
+
+
+/**
+ * @brief Compute a quarter-circle arc for a shadow layer (triangle fan).
+ *
+ * @param geometry The mesh to add to.
  * @param center The center position of the arc.
- * @param outerRadius The outer radius of the arc.
- * @param startAngleDeg The starting angle of the arc in degrees.
- * @param endAngleDeg The ending angle of the arc in degrees.
- * @param modifiedShadowColor The modified shadow color for this layer.
- */
-SFUI::Void SFUI::Component::computeShadowArcGeometry(SFUI::Vector2f center, SFUI::Float outerRadius, SFUI::Float startAngleDeg, SFUI::Float endAngleDeg, SFUI::Color modifiedShadowColor) {
-    SFUI::Float arcResolution = std::clamp(static_cast<SFUI::Int>(outerRadius * 0.25f), 4, 12);
-    SFUI::Float startRadians = startAngleDeg * M_PI / 180.f;
-    SFUI::Float endRadians = endAngleDeg * M_PI / 180.f;
-    SFUI::Float angleStep = (endRadians - startRadians) / static_cast<SFUI::Float>(arcResolution);
-
-    for (SFUI::Int i = 0; i < arcResolution; ++i) {
-        SFUI::Float angle0 = startRadians + i * angleStep;
-        SFUI::Float angle1 = startRadians + (i + 1) * angleStep;
-        SFUI::Vector2f outer0(center.x + std::cos(angle0) * outerRadius, center.y + std::sin(angle0) * outerRadius);
-        SFUI::Vector2f outer1(center.x + std::cos(angle1) * outerRadius, center.y + std::sin(angle1) * outerRadius);
-        SFUI::Vector2f inner(center);
-        shadowArcs.append({outer0, modifiedShadowColor});
-        shadowArcs.append({outer1, modifiedShadowColor});
-        shadowArcs.append({inner, modifiedShadowColor});
+ * @param radius The radius of the arc.
+ * @param startAngleDeg The starting angle of the arc in degrees, the arc ending 90 degrees later.
+ * @param layerColor The shadow color of the layer.
+ */
+SFUI::Void SFUI::Component::computeShadowArcGeometry(SFUI::Mesh& geometry, SFUI::Vector2f center, SFUI::Float radius, SFUI::Float startAngleDeg, SFUI::Color layerColor) const {
+    SFUI::Int arcResolution = SFUI::ArcTessellator::getResolution(radius, getArcDetail());
+    SFUI::Float outerX[SFUI::ArcTessellator::maxPointCount];
+    SFUI::Float outerY[SFUI::ArcTessellator::maxPointCount];
+    SFUI::ArcTessellator::tessellate(center, radius, startAngleDeg, arcResolution, outerX, outerY);
+
+    SFUI::Mesh::Index centerIndex = geometry.addVertex(center, layerColor);
+    SFUI::Mesh::Index previousIndex = geometry.addVertex({outerX[0], outerY[0]}, layerColor);
+    for (SFUI::Int i = 1; i <= arcResolution; ++i) {
+        SFUI::Mesh::Index outerIndex = geometry.addVertex({outerX[i], outerY[i]}, layerColor);
+        geometry.addTriangle(previousIndex, outerIndex, centerIndex);
+        previousIndex = outerIndex;
     }
 }
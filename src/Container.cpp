@@ -41,8 +41,7 @@ SFUI::Void SFUI::Container::handleEvent(const SFUI::Event& event) {}
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Container::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
 }
 
@@ -54,14 +53,23 @@ SFUI::Void SFUI::Container::preUpdate() {
  */
 SFUI::Void SFUI::Container::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeColors();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeColors();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
+    clearDirtyFlags();
 }
 
 
@@ -72,12 +80,7 @@ SFUI::Void SFUI::Container::update(const SFUI::Vector2u renderTargetSize) {
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::Container::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
+    drawMesh(drawTarget);
 }
 
 
@@ -93,3 +96,18 @@ SFUI::Void SFUI::Container::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWin
  * @param window Window reference.
  */
 SFUI::Void SFUI::Container::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {}
+
+
+/**
+ * @brief Get the event types consumed by the container.
+ *
+ * @return No event types, as containers do not handle events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Container::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = false;
+    subscriptions.keyboard = false;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
@@ -42,9 +42,9 @@ SFUI::Void SFUI::Graphic::handleEvent(const SFUI::Event& event) {}
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Graphic::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
+    if (commitProps(committedStyle, this->style)) markStyleDirty();
 }
 
 
@@ -55,16 +55,25 @@ SFUI::Void SFUI::Graphic::preUpdate() {
  */
 SFUI::Void SFUI::Graphic::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeColors();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeColors();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeGraphicSource();
     computeGraphicLayout();
+    clearDirtyFlags();
 }
 
 
@@ -75,50 +84,12 @@ SFUI::Void SFUI::Graphic::update(const SFUI::Vector2u renderTargetSize) {
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::Graphic::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
-
-    // Save Clipping State for Containing The Sprite within Graphic's Bounds and Padding //
-    GLint parentClipping[4];
-    GLboolean scissorWasEnabled = glIsEnabled(GL_SCISSOR_TEST);
-    if (scissorWasEnabled) glGetIntegerv(GL_SCISSOR_BOX, parentClipping);
-    SFUI::Vector2i graphicPosition = computedLayout.position;
-    SFUI::Vector2f graphicSize = computedLayout.size;
-    SFUI::Vector4f graphicPadding = computedLayout.padding;
-    GLint newClipping[4] = {
-        static_cast<GLint>(graphicPosition.x + graphicPadding.x),
-        static_cast<GLint>(drawTarget.getSize().y - (graphicPosition.y + graphicPadding.z) - (graphicSize.y - graphicPadding.z - graphicPadding.w)),
-        static_cast<GLint>(graphicSize.x - (graphicPadding.x + graphicPadding.y)),
-        static_cast<GLint>(graphicSize.y - (graphicPadding.z + graphicPadding.w))
-    };
-    if (scissorWasEnabled) {
-        GLint newRight = newClipping[0] + newClipping[2];
-        GLint newBottom = newClipping[1] + newClipping[3];
-        GLint parentRight = parentClipping[0] + parentClipping[2];
-        GLint parentBottom = parentClipping[1] + parentClipping[3];
-        newClipping[0] = std::max(newClipping[0], parentClipping[0]);
-        newClipping[1] = std::max(newClipping[1], parentClipping[1]);
-        newClipping[2] = std::min(newRight, parentRight) - newClipping[0];
-        newClipping[3] = std::min(newBottom, parentBottom) - newClipping[1];
-        newClipping[2] = std::max(0, newClipping[2]);
-        newClipping[3] = std::max(0, newClipping[3]);
-    };
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(newClipping[0], newClipping[1], newClipping[2], newClipping[3]);
-
-    // Draw Clipped Sprite //
-    drawTarget.draw(graphic);
+    drawMesh(drawTarget);
 
-    // Restore Previous Clipping //
-    if (scissorWasEnabled) {
-        glScissor(parentClipping[0], parentClipping[1], parentClipping[2], parentClipping[3]);
-    }   else {
-        glDisable(GL_SCISSOR_TEST);
-    }
+    // Draw Sprite Clipped within Graphic's Bounds and Padding, and the Clip It Is Drawn In //
+    SFUI::FloatRect previousScissor = SFUI::ClipStack::intersect(drawTarget, getContentBox());
+    drawTarget.draw(graphic);
+    SFUI::ClipStack::restore(drawTarget, previousScissor);
 }
 
 
@@ -136,6 +107,36 @@ SFUI::Void SFUI::Graphic::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindo
 SFUI::Void SFUI::Graphic::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {}
 
 
+/**
+ * @brief Draw the graphic's geometry and its sprite through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Graphic::drawBatched(SFUI::RenderBatch& renderBatch) {
+    SFUI::Component::drawBatched(renderBatch);
+
+    // Draw Sprite Clipped within Graphic's Bounds and Padding //
+    renderBatch.pushClip(getContentBox());
+    renderBatch.draw(graphic);
+    renderBatch.popClip();
+}
+
+
+/**
+ * @brief Get the event types consumed by the graphic.
+ *
+ * @return No event types, as graphics do not handle events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Graphic::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = false;
+    subscriptions.keyboard = false;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Get the original size at the time of loading for the texture used in the graphic.
  *
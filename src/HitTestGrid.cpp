@@ -0,0 +1,194 @@
+/**
+ * @file HitTestGrid.cpp
+ * @brief Implements the SFUI HitTestGrid spatial index.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI HitTestGrid class. It handles:
+ *   - Inserting and moving component hit bounds
+ *   - Mapping bounds onto the grid cells they overlap
+ *   - Point queries against a single grid cell
+ *
+ * It works in conjunction with HitTestGrid.hpp to provide full functionality
+ * for mouse event routing.
+ */
+
+
+#include "Base/HitTestGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * @brief Constructor for HitTestGrid.
+ *
+ * @param cellSize The side length of a grid cell in pixels.
+ */
+SFUI::HitTestGrid::HitTestGrid(SFUI::Float cellSize) :
+    cellSize(cellSize)
+{}
+
+
+/**
+ * @brief Remove every entry and resize the grid to cover an area.
+ *
+ * @param areaSize The size of the area covered by the grid.
+ */
+SFUI::Void SFUI::HitTestGrid::reset(const SFUI::Vector2u& areaSize) {
+    cellCount = {
+        std::max(1u, static_cast<SFUI::UnsignedInt>(std::ceil(areaSize.x / cellSize))),
+        std::max(1u, static_cast<SFUI::UnsignedInt>(std::ceil(areaSize.y / cellSize)))
+    };
+    entries.clear();
+    entryIndices.clear();
+    cells.assign(cellCount.x * cellCount.y, {});
+}
+
+
+/**
+ * @brief Insert a component or move its existing entry.
+ *
+ * @param component The component to index.
+ * @param bounds The clipped hit bounds of the component, empty if fully clipped.
+ * @param childClip The clip rectangle applied to the component's children.
+ * @param order The traversal order of the component.
+ */
+SFUI::Void SFUI::HitTestGrid::insert(SFUI::Component* component, const SFUI::Optional<SFUI::FloatRect>& bounds, const SFUI::FloatRect& childClip, SFUI::Size order) {
+    auto entryIndexIterator = entryIndices.find(component);
+    SFUI::Size entryIndex;
+    if (entryIndexIterator == entryIndices.end()) {
+        entryIndex = entries.size();
+        entries.push_back({component, std::nullopt, childClip, order, {0, 0}, {0, 0}});
+        entryIndices[component] = entryIndex;
+    }   else {
+        entryIndex = entryIndexIterator->second;
+        removeFromCells(entryIndex);
+    }
+
+    SFUI::HitTestGrid::Entry& entry = entries[entryIndex];
+    entry.bounds = bounds;
+    entry.childClip = childClip;
+    entry.order = order;
+    addToCells(entryIndex);
+}
+
+
+/**
+ * @brief Check if a component has an entry in the grid.
+ *
+ * @param component The component to look up.
+ *
+ * @return true if indexed, false otherwise.
+ */
+SFUI::Bool SFUI::HitTestGrid::contains(const SFUI::Component* component) const {
+    return entryIndices.find(component) != entryIndices.end();
+}
+
+
+/**
+ * @brief Get the clip rectangle applied to the children of an indexed component.
+ *
+ * @param component The indexed component.
+ *
+ * @return The clip rectangle of the component's children.
+ */
+const SFUI::FloatRect& SFUI::HitTestGrid::getChildClip(const SFUI::Component* component) const {
+    return entries[entryIndices.at(component)].childClip;
+}
+
+
+/**
+ * @brief Get the traversal order of an indexed component.
+ *
+ * @param component The indexed component.
+ *
+ * @return The traversal order of the component.
+ */
+SFUI::Size SFUI::HitTestGrid::getOrder(const SFUI::Component* component) const {
+    return entries[entryIndices.at(component)].order;
+}
+
+
+/**
+ * @brief Find every component whose hit bounds contain a point.
+ *
+ * Only the entries referenced by the single cell containing the point are tested.
+ *
+ * @param point The point to test.
+ * @param hits The output list the hit components are appended to.
+ */
+SFUI::Void SFUI::HitTestGrid::query(const SFUI::Vector2f& point, SFUI::Vector<SFUI::Component*>& hits) const {
+    if (cells.empty() || point.x < 0.0f || point.y < 0.0f) return;
+    SFUI::UnsignedInt cellX = static_cast<SFUI::UnsignedInt>(point.x / cellSize);
+    SFUI::UnsignedInt cellY = static_cast<SFUI::UnsignedInt>(point.y / cellSize);
+    if (cellX >= cellCount.x || cellY >= cellCount.y) return;
+
+    // Narrow Phase Against the Entries of the Single Cell Containing the Point //
+    for (SFUI::Size entryIndex : cells[cellY * cellCount.x + cellX]) {
+        const SFUI::HitTestGrid::Entry& entry = entries[entryIndex];
+        if (entry.bounds.has_value() && entry.bounds.value().contains(point)) hits.push_back(entry.component);
+    }
+}
+
+
+/**
+ * @brief Get the number of indexed components.
+ *
+ * @return The number of entries.
+ */
+SFUI::Size SFUI::HitTestGrid::getEntryCount() const {
+    return entries.size();
+}
+
+
+/**
+ * @brief Reference an entry from every cell its bounds overlap.
+ *
+ * @param entryIndex The index of the entry.
+ */
+SFUI::Void SFUI::HitTestGrid::addToCells(SFUI::Size entryIndex) {
+    SFUI::HitTestGrid::Entry& entry = entries[entryIndex];
+    entry.firstCell = {0, 0};
+    entry.lastCell = {0, 0};
+    if (!entry.bounds.has_value()) return;
+
+    // Clamp the Covered Cell Range to the Grid //
+    const SFUI::FloatRect& bounds = entry.bounds.value();
+    SFUI::Float right = bounds.position.x + bounds.size.x;
+    SFUI::Float bottom = bounds.position.y + bounds.size.y;
+    if (right <= 0.0f || bottom <= 0.0f || bounds.size.x <= 0.0f || bounds.size.y <= 0.0f) return;
+    SFUI::Float maxCellX = static_cast<SFUI::Float>(cellCount.x - 1);
+    SFUI::Float maxCellY = static_cast<SFUI::Float>(cellCount.y - 1);
+    entry.firstCell = {
+        static_cast<SFUI::UnsignedInt>(std::clamp(std::floor(bounds.position.x / cellSize), 0.0f, maxCellX)),
+        static_cast<SFUI::UnsignedInt>(std::clamp(std::floor(bounds.position.y / cellSize), 0.0f, maxCellY))
+    };
+    entry.lastCell = {
+        static_cast<SFUI::UnsignedInt>(std::clamp(std::floor(right / cellSize), 0.0f, maxCellX)) + 1,
+        static_cast<SFUI::UnsignedInt>(std::clamp(std::floor(bottom / cellSize), 0.0f, maxCellY)) + 1
+    };
+
+    for (SFUI::UnsignedInt y = entry.firstCell.y; y < entry.lastCell.y; y++) {
+        for (SFUI::UnsignedInt x = entry.firstCell.x; x < entry.lastCell.x; x++) {
+            cells[y * cellCount.x + x].push_back(entryIndex);
+        }
+    }
+}
+
+
+/**
+ * @brief Remove an entry from every cell it is referenced by.
+ *
+ * @param entryIndex The index of the entry.
+ */
+SFUI::Void SFUI::HitTestGrid::removeFromCells(SFUI::Size entryIndex) {
+    const SFUI::HitTestGrid::Entry& entry = entries[entryIndex];
+    for (SFUI::UnsignedInt y = entry.firstCell.y; y < entry.lastCell.y; y++) {
+        for (SFUI::UnsignedInt x = entry.firstCell.x; x < entry.lastCell.x; x++) {
+            SFUI::Vector<SFUI::Size>& cell = cells[y * cellCount.x + x];
+            cell.erase(std::remove(cell.begin(), cell.end(), entryIndex), cell.end());
+        }
+    }
+}
@@ -54,9 +54,13 @@ SFUI::Void SFUI::Label::handleEvent(const SFUI::Event& event) {}
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Label::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
+    if (commitProps(committedStyle, this->style)) {
+        compiledLabelStyle.textColor = resolveColorSubProp(style.textColor);
+        compiledLabelStyle.textOutlineColor = resolveColorSubProp(style.textOutlineColor);
+        markStyleDirty();
+    }
 }
 
 
@@ -67,17 +71,26 @@ SFUI::Void SFUI::Label::preUpdate() {
  */
 SFUI::Void SFUI::Label::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeColors();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeColors();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeTextCore();
     computeTextStyles();
     computeTextLayout();
+    clearDirtyFlags();
 }
 
 
@@ -88,50 +101,12 @@ SFUI::Void SFUI::Label::update(const SFUI::Vector2u renderTargetSize) {
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::Label::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
-
-    // Save Clipping State for Containing Text within Label's Bounds and Padding //
-    GLint parentClipping[4];
-    GLboolean scissorWasEnabled = glIsEnabled(GL_SCISSOR_TEST);
-    if (scissorWasEnabled) glGetIntegerv(GL_SCISSOR_BOX, parentClipping);
-    SFUI::Vector2i labelPosition = computedLayout.position;
-    SFUI::Vector2f labelSize = computedLayout.size;
-    SFUI::Vector4f labelPadding = computedLayout.padding;
-    GLint newClipping[4] = {
-        static_cast<GLint>(labelPosition.x + labelPadding.x),
-        static_cast<GLint>(drawTarget.getSize().y - (labelPosition.y + labelPadding.z) - (labelSize.y - labelPadding.z - labelPadding.w)),
-        static_cast<GLint>(labelSize.x - (labelPadding.x + labelPadding.y)),
-        static_cast<GLint>(labelSize.y - (labelPadding.z + labelPadding.w))
-    };
-    if (scissorWasEnabled) {
-        GLint newRight = newClipping[0] + newClipping[2];
-        GLint newBottom = newClipping[1] + newClipping[3];
-        GLint parentRight = parentClipping[0] + parentClipping[2];
-        GLint parentBottom = parentClipping[1] + parentClipping[3];
-        newClipping[0] = std::max(newClipping[0], parentClipping[0]);
-        newClipping[1] = std::max(newClipping[1], parentClipping[1]);
-        newClipping[2] = std::min(newRight, parentRight) - newClipping[0];
-        newClipping[3] = std::min(newBottom, parentBottom) - newClipping[1];
-        newClipping[2] = std::max(0, newClipping[2]);
-        newClipping[3] = std::max(0, newClipping[3]);
-    };
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(newClipping[0], newClipping[1], newClipping[2], newClipping[3]);
-
-    // Draw Clipped Text //
-    drawTarget.draw(textObject);
+    drawMesh(drawTarget);
 
-    // Restore Previous Clipping //
-    if (scissorWasEnabled) {
-        glScissor(parentClipping[0], parentClipping[1], parentClipping[2], parentClipping[3]);
-    }   else {
-        glDisable(GL_SCISSOR_TEST);
-    }
+    // Draw Text Clipped within Label's Bounds and Padding, and the Clip It Is Drawn In //
+    SFUI::FloatRect previousScissor = SFUI::ClipStack::intersect(drawTarget, getContentBox());
+    drawTarget.draw(textObject);
+    SFUI::ClipStack::restore(drawTarget, previousScissor);
 }
 
 
@@ -149,6 +124,36 @@ SFUI::Void SFUI::Label::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow&
 SFUI::Void SFUI::Label::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {}
 
 
+/**
+ * @brief Draw the label's geometry and its text through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Label::drawBatched(SFUI::RenderBatch& renderBatch) {
+    SFUI::Component::drawBatched(renderBatch);
+
+    // Merge Text Glyphs Clipped within Label's Bounds and Padding //
+    renderBatch.pushClip(getContentBox());
+    renderBatch.appendText(textObject);
+    renderBatch.popClip();
+}
+
+
+/**
+ * @brief Get the event types consumed by the label.
+ *
+ * @return No event types, as labels do not handle events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Label::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = false;
+    subscriptions.keyboard = false;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Get the font used by the label.
  *
@@ -245,8 +250,8 @@ SFUI::Void SFUI::Label::computeTextStyles() {
     if (style.textOutlineThickness >= 0.0f) textObject.setOutlineThickness(style.textOutlineThickness);
 
     // Colors //
-    textObject.setFillColor(resolveColorSubProp(style.textColor));
-    textObject.setOutlineColor(resolveColorSubProp(style.textOutlineColor));
+    textObject.setFillColor(compiledLabelStyle.textColor);
+    textObject.setOutlineColor(compiledLabelStyle.textOutlineColor);
 }
 
 
@@ -0,0 +1,210 @@
+/**
+ * @file LayerCache.cpp
+ * @brief Implements the SFUI LayerCache texture layer cache.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI LayerCache class. It handles:
+ *   - Creating and resizing the render textures of cached layers
+ *   - Invalidating layers whose subtree changed
+ *   - Evicting the least recently used layers over the memory budget
+ *
+ * It works in conjunction with LayerCache.hpp to provide full functionality
+ * for caching subtrees of the UI as texture layers.
+ */
+
+
+#include "Base/LayerCache.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * @brief Constructor for LayerCache.
+ */
+SFUI::LayerCache::LayerCache() {}
+
+
+/**
+ * @brief Set the memory budget of the layers.
+ *
+ * @param budgetBytes The budget in bytes.
+ */
+SFUI::Void SFUI::LayerCache::setBudget(SFUI::Size budgetBytes) {
+    this->budgetBytes = budgetBytes;
+}
+
+
+/**
+ * @brief Start a frame, resetting the per-frame statistics.
+ */
+SFUI::Void SFUI::LayerCache::beginFrame() {
+    frame++;
+    renderedLayers = 0;
+    evictedLayers = 0;
+}
+
+
+/**
+ * @brief End a frame, evicting the least recently used layers while over budget.
+ *
+ * Layers drawn in the current frame are never evicted, so the budget can be exceeded
+ * when the visible layers alone do not fit in it.
+ */
+SFUI::Void SFUI::LayerCache::endFrame() {
+    while (layerBytes > budgetBytes) {
+        auto leastRecentlyUsed = layers.end();
+        for (auto layerIterator = layers.begin(); layerIterator != layers.end(); layerIterator++) {
+            if (layerIterator->second->lastUsedFrame == frame) continue;
+            if (leastRecentlyUsed == layers.end() || layerIterator->second->lastUsedFrame < leastRecentlyUsed->second->lastUsedFrame)
+                leastRecentlyUsed = layerIterator;
+        }
+        if (leastRecentlyUsed == layers.end()) return;
+
+        SFUI::Vector2u textureSize = {leastRecentlyUsed->second->renderTexture.getSize().x, leastRecentlyUsed->second->renderTexture.getSize().y};
+        layerBytes -= getByteSize(textureSize);
+        layers.erase(leastRecentlyUsed);
+        evictedLayers++;
+    }
+}
+
+
+/**
+ * @brief Get the layer of a component, creating or resizing it to its draw bounds.
+ *
+ * The draw bounds are snapped outwards to whole pixels. A layer whose bounds moved or
+ * were resized must be drawn again. Components too large for the budget, or whose render
+ * texture cannot be created, get no layer.
+ *
+ * @param component The component cached as a layer.
+ * @param drawBounds The draw bounds of the component.
+ *
+ * @return The layer to draw, invalid if it must be redrawn, or nullptr if the component must be drawn directly.
+ */
+SFUI::LayerCache::Layer* SFUI::LayerCache::acquire(const SFUI::Component* component, const SFUI::FloatRect& drawBounds) {
+    SFUI::Float left = std::floor(drawBounds.position.x);
+    SFUI::Float top = std::floor(drawBounds.position.y);
+    SFUI::Float right = std::ceil(drawBounds.position.x + drawBounds.size.x);
+    SFUI::Float bottom = std::ceil(drawBounds.position.y + drawBounds.size.y);
+    SFUI::FloatRect bounds({left, top}, {right - left, bottom - top});
+    SFUI::Vector2u textureSize(static_cast<SFUI::UnsignedInt>(bounds.size.x), static_cast<SFUI::UnsignedInt>(bounds.size.y));
+
+    SFUI::Size byteSize = getByteSize(textureSize);
+    if (byteSize == 0 || byteSize > budgetBytes) {
+        release(component);
+        return nullptr;
+    }
+
+    SFUI::UniquePointer<SFUI::LayerCache::Layer>& layer = layers[component];
+    if (!layer) layer = std::make_unique<SFUI::LayerCache::Layer>();
+
+    // Resizing Recreates the Render Texture and Discards Its Contents //
+    SFUI::Vector2u currentSize = {layer->renderTexture.getSize().x, layer->renderTexture.getSize().y};
+    if (currentSize != textureSize) {
+        layerBytes -= getByteSize(currentSize);
+        layer->valid = false;
+        if (!layer->renderTexture.resize(textureSize)) {
+            layers.erase(component);
+            return nullptr;
+        }
+        layerBytes += byteSize;
+    }
+
+    if (layer->bounds != bounds) {
+        layer->bounds = bounds;
+        layer->valid = false;
+    }
+    layer->lastUsedFrame = frame;
+    return layer.get();
+}
+
+
+/**
+ * @brief Flag a layer as drawn and up to date.
+ *
+ * @param layer The layer that was drawn into.
+ */
+SFUI::Void SFUI::LayerCache::validate(SFUI::LayerCache::Layer& layer) {
+    layer.valid = true;
+    renderedLayers++;
+}
+
+
+/**
+ * @brief Flag the layer of a component as outdated, if it has one.
+ *
+ * @param component The component whose subtree changed.
+ */
+SFUI::Void SFUI::LayerCache::invalidate(const SFUI::Component* component) {
+    auto layerIterator = layers.find(component);
+    if (layerIterator != layers.end()) layerIterator->second->valid = false;
+}
+
+
+/**
+ * @brief Free the layer of a component, if it has one.
+ *
+ * @param component The component that no longer needs a layer.
+ */
+SFUI::Void SFUI::LayerCache::release(const SFUI::Component* component) {
+    auto layerIterator = layers.find(component);
+    if (layerIterator == layers.end()) return;
+    SFUI::Vector2u textureSize = {layerIterator->second->renderTexture.getSize().x, layerIterator->second->renderTexture.getSize().y};
+    layerBytes -= getByteSize(textureSize);
+    layers.erase(layerIterator);
+}
+
+
+/**
+ * @brief Free the layers of components that are not part of the UI tree anymore.
+ *
+ * A removed component's address may be reused by a new component, so its layer must not outlive it.
+ * Only called when the tree structure changes, and the few layers are each looked up linearly.
+ *
+ * @param components The components of the UI tree.
+ */
+SFUI::Void SFUI::LayerCache::prune(const SFUI::Vector<SFUI::Component*>& components) {
+    for (auto layerIterator = layers.begin(); layerIterator != layers.end();) {
+        if (std::find(components.begin(), components.end(), layerIterator->first) != components.end()) {
+            layerIterator++;
+            continue;
+        }
+        SFUI::Vector2u textureSize = {layerIterator->second->renderTexture.getSize().x, layerIterator->second->renderTexture.getSize().y};
+        layerBytes -= getByteSize(textureSize);
+        layerIterator = layers.erase(layerIterator);
+    }
+}
+
+
+/**
+ * @brief Check if no layer is cached.
+ *
+ * @return True if empty, false otherwise.
+ */
+SFUI::Bool SFUI::LayerCache::isEmpty() const {
+    return layers.empty();
+}
+
+
+/**
+ * @brief Get the memory statistics of the layers.
+ *
+ * @return The layer count and memory, budget, and the layers rendered and evicted in the current frame.
+ */
+SFUI::LayerCache::Statistics SFUI::LayerCache::getStatistics() const {
+    return {layers.size(), layerBytes, budgetBytes, renderedLayers, evictedLayers};
+}
+
+
+/**
+ * @brief Get the memory used by a render texture.
+ *
+ * @param size The size of the render texture in pixels.
+ *
+ * @return The memory used in bytes, at 4 bytes per pixel.
+ */
+SFUI::Size SFUI::LayerCache::getByteSize(const SFUI::Vector2u& size) {
+    return static_cast<SFUI::Size>(size.x) * size.y * 4;
+}
@@ -0,0 +1,332 @@
+/**
+ * @file Mesh.cpp
+ * @brief Implements the SFUI Mesh indexed triangle mesh.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI Mesh class. It handles:
+ *   - Building indexed triangles from unique vertices
+ *   - Translating the mesh without rebuilding it
+ *   - Expanding the indexed triangles for SFML drawing
+ *
+ * It works in conjunction with Mesh.hpp to provide full functionality
+ * for component geometry.
+ */
+
+
+#include "Base/Mesh.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+SFUI::Size SFUI::Mesh::nextVersion = 0;
+
+
+/**
+ * @brief Constructor for Mesh.
+ */
+SFUI::Mesh::Mesh() :
+    version(nextVersion++),
+    expandedTriangles(SFUI::PrimitiveType::Triangles)
+{}
+
+
+/**
+ * @brief Remove every vertex and triangle.
+ */
+SFUI::Void SFUI::Mesh::clear() {
+    vertices.clear();
+    indices.clear();
+    markModified();
+}
+
+
+/**
+ * @brief Check if the mesh has no triangles.
+ *
+ * @return True if empty, false otherwise.
+ */
+SFUI::Bool SFUI::Mesh::isEmpty() const {
+    return indices.empty();
+}
+
+
+/**
+ * @brief Add a vertex.
+ *
+ * @param position The position of the vertex.
+ * @param color The color of the vertex.
+ *
+ * @return The index of the added vertex.
+ */
+SFUI::Mesh::Index SFUI::Mesh::addVertex(const SFUI::Vector2f& position, const SFUI::Color& color) {
+    vertices.push_back({position, color});
+    markModified();
+    return static_cast<SFUI::Mesh::Index>(vertices.size() - 1);
+}
+
+
+/**
+ * @brief Add a triangle between three vertices.
+ *
+ * @param a The index of the first vertex.
+ * @param b The index of the second vertex.
+ * @param c The index of the third vertex.
+ */
+SFUI::Void SFUI::Mesh::addTriangle(SFUI::Mesh::Index a, SFUI::Mesh::Index b, SFUI::Mesh::Index c) {
+    indices.push_back(a);
+    indices.push_back(b);
+    indices.push_back(c);
+    markModified();
+}
+
+
+/**
+ * @brief Add an axis-aligned rectangle of a single color.
+ *
+ * @param position The top-left position of the rectangle.
+ * @param size The size of the rectangle.
+ * @param color The color of the rectangle.
+ */
+SFUI::Void SFUI::Mesh::addRect(const SFUI::Vector2f& position, const SFUI::Vector2f& size, const SFUI::Color& color) {
+    SFUI::Mesh::Index topLeft = addVertex(position, color);
+    SFUI::Mesh::Index topRight = addVertex({position.x + size.x, position.y}, color);
+    SFUI::Mesh::Index bottomRight = addVertex({position.x + size.x, position.y + size.y}, color);
+    SFUI::Mesh::Index bottomLeft = addVertex({position.x, position.y + size.y}, color);
+    addTriangle(topLeft, topRight, bottomRight);
+    addTriangle(topLeft, bottomRight, bottomLeft);
+}
+
+
+/**
+ * @brief Move every vertex by an offset.
+ *
+ * @param offset The offset to move by.
+ */
+SFUI::Void SFUI::Mesh::translate(const SFUI::Vector2f& offset) {
+    for (SFUI::Mesh::Vertex& vertex : vertices) {
+        vertex.position.x += offset.x;
+        vertex.position.y += offset.y;
+    }
+    markModified();
+}
+
+
+/**
+ * @brief Get the unique vertices of the mesh.
+ *
+ * @return The vertices, in the order they were added.
+ */
+const SFUI::Vector<SFUI::Mesh::Vertex>& SFUI::Mesh::getVertices() const {
+    return vertices;
+}
+
+
+/**
+ * @brief Get the triangle indices of the mesh, three per triangle.
+ *
+ * @return The indices, in drawing order.
+ */
+const SFUI::Vector<SFUI::Mesh::Index>& SFUI::Mesh::getIndices() const {
+    return indices;
+}
+
+
+/**
+ * @brief Get the version of the mesh, which changes on every modification.
+ *
+ * @return The version of the mesh.
+ */
+SFUI::Size SFUI::Mesh::getVersion() const {
+    return version;
+}
+
+
+/**
+ * @brief Get the area covered by the triangles of the mesh, counting overlapping triangles once each.
+ *
+ * @return The area in square pixels.
+ */
+SFUI::Float SFUI::Mesh::getArea() const {
+    if (areaValid) return area;
+    area = 0.0f;
+    for (SFUI::Size i = 0; i + 2 < indices.size(); i += 3) {
+        const SFUI::Vector2f& a = vertices[indices[i]].position;
+        const SFUI::Vector2f& b = vertices[indices[i + 1]].position;
+        const SFUI::Vector2f& c = vertices[indices[i + 2]].position;
+        area += std::abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) * 0.5f;
+    }
+    areaValid = true;
+    return area;
+}
+
+
+/**
+ * @brief Get the axis-aligned bounding box of the vertices of the mesh.
+ *
+ * @return The bounding box, or an empty rectangle if the mesh is empty.
+ */
+SFUI::FloatRect SFUI::Mesh::getBounds() const {
+    if (boundsValid) return bounds;
+    bounds = SFUI::FloatRect();
+    if (!vertices.empty()) {
+        SFUI::Float left = vertices.front().position.x, top = vertices.front().position.y;
+        SFUI::Float right = left, bottom = top;
+        for (const SFUI::Mesh::Vertex& vertex : vertices) {
+            left = std::min(left, vertex.position.x);
+            top = std::min(top, vertex.position.y);
+            right = std::max(right, vertex.position.x);
+            bottom = std::max(bottom, vertex.position.y);
+        }
+        bounds = SFUI::FloatRect({left, top}, {right - left, bottom - top});
+    }
+    boundsValid = true;
+    return bounds;
+}
+
+
+/**
+ * @brief Append the triangles of the mesh to a triangle vertex array.
+ *
+ * SFML has no indexed drawing, so the indices are resolved here, once per drawn vertex.
+ *
+ * @param triangles The vertex array using the Triangles primitive type.
+ * @param offset The offset the vertices are moved by.
+ */
+SFUI::Void SFUI::Mesh::appendTo(SFUI::VertexArray& triangles, const SFUI::Vector2f& offset) const {
+    sf::Vector2f vertexOffset = offset;
+    for (SFUI::Mesh::Index index : indices) {
+        const SFUI::Mesh::Vertex& vertex = vertices[index];
+        triangles.append({sf::Vector2f(vertex.position) + vertexOffset, vertex.color});
+    }
+}
+
+
+/**
+ * @brief Append the triangles of the mesh, cut to a clip rectangle, to a triangle vertex array.
+ *
+ * Triangles inside the clip are appended as they are and those outside of it are skipped.
+ * The others are cut by each edge of the clip in turn, interpolating the colors along the
+ * cut sides, and the remaining convex polygon is appended as a triangle fan.
+ *
+ * @param triangles The vertex array using the Triangles primitive type.
+ * @param clipRect The clip rectangle the moved triangles are cut to.
+ * @param offset The offset the vertices are moved by.
+ */
+SFUI::Void SFUI::Mesh::appendClippedTo(SFUI::VertexArray& triangles, const SFUI::FloatRect& clipRect, const SFUI::Vector2f& offset) const {
+    SFUI::Float left = clipRect.position.x;
+    SFUI::Float top = clipRect.position.y;
+    SFUI::Float right = clipRect.position.x + clipRect.size.x;
+    SFUI::Float bottom = clipRect.position.y + clipRect.size.y;
+    sf::Vector2f vertexOffset = offset;
+
+    // A Triangle Cut by Four Edges Has at Most Seven Vertices //
+    SFUI::Array<SFUI::Vertex, 8> polygon;
+    SFUI::Array<SFUI::Vertex, 8> cutPolygon;
+    for (SFUI::Size i = 0; i + 2 < indices.size(); i += 3) {
+        const SFUI::Mesh::Vertex& a = vertices[indices[i]];
+        const SFUI::Mesh::Vertex& b = vertices[indices[i + 1]];
+        const SFUI::Mesh::Vertex& c = vertices[indices[i + 2]];
+        polygon[0] = {sf::Vector2f(a.position) + vertexOffset, a.color};
+        polygon[1] = {sf::Vector2f(b.position) + vertexOffset, b.color};
+        polygon[2] = {sf::Vector2f(c.position) + vertexOffset, c.color};
+        SFUI::Float minX = std::min({polygon[0].position.x, polygon[1].position.x, polygon[2].position.x});
+        SFUI::Float maxX = std::max({polygon[0].position.x, polygon[1].position.x, polygon[2].position.x});
+        SFUI::Float minY = std::min({polygon[0].position.y, polygon[1].position.y, polygon[2].position.y});
+        SFUI::Float maxY = std::max({polygon[0].position.y, polygon[1].position.y, polygon[2].position.y});
+        if (maxX <= left || minX >= right || maxY <= top || minY >= bottom) continue;
+        if (minX >= left && maxX <= right && minY >= top && maxY <= bottom) {
+            triangles.append(polygon[0]);
+            triangles.append(polygon[1]);
+            triangles.append(polygon[2]);
+            continue;
+        }
+
+        SFUI::Size vertexCount = 3;
+        vertexCount = clipPolygon(polygon.data(), vertexCount, cutPolygon.data(), true, left, true);
+        vertexCount = clipPolygon(cutPolygon.data(), vertexCount, polygon.data(), true, right, false);
+        vertexCount = clipPolygon(polygon.data(), vertexCount, cutPolygon.data(), false, top, true);
+        vertexCount = clipPolygon(cutPolygon.data(), vertexCount, polygon.data(), false, bottom, false);
+        for (SFUI::Size j = 1; j + 1 < vertexCount; j++) {
+            triangles.append(polygon[0]);
+            triangles.append(polygon[j]);
+            triangles.append(polygon[j + 1]);
+        }
+    }
+}
+
+
+/**
+ * @brief Draw the mesh to a render target.
+ *
+ * @param drawTarget The target to draw on.
+ * @param states The render states to draw with.
+ */
+SFUI::Void SFUI::Mesh::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderStates states) const {
+    if (indices.empty()) return;
+    if (!expandedTrianglesValid) {
+        expandedTriangles.clear();
+        appendTo(expandedTriangles);
+        expandedTrianglesValid = true;
+    }
+    drawTarget.draw(expandedTriangles, states);
+}
+
+
+/**
+ * @brief Give the mesh a new version after a modification.
+ */
+SFUI::Void SFUI::Mesh::markModified() {
+    version = nextVersion++;
+    expandedTrianglesValid = false;
+    areaValid = false;
+    boundsValid = false;
+}
+
+
+/**
+ * @brief Cut a convex polygon by an axis-aligned edge of a clip rectangle.
+ *
+ * One pass of Sutherland-Hodgman clipping: vertices on the kept side are kept, and a vertex is
+ * interpolated wherever a side of the polygon crosses the edge.
+ *
+ * @param input The vertices of the polygon.
+ * @param inputCount The number of vertices of the polygon.
+ * @param output The vertices of the cut polygon, with room for one more vertex than the input.
+ * @param vertical Whether the edge is vertical, cutting along the x-axis.
+ * @param edge The coordinate of the edge.
+ * @param keepAbove Whether the part above the edge coordinate is kept, or the part below.
+ *
+ * @return The number of vertices of the cut polygon.
+ */
+SFUI::Size SFUI::Mesh::clipPolygon(const SFUI::Vertex* input, SFUI::Size inputCount, SFUI::Vertex* output, SFUI::Bool vertical, SFUI::Float edge, SFUI::Bool keepAbove) {
+    SFUI::Size outputCount = 0;
+    for (SFUI::Size i = 0; i < inputCount; i++) {
+        const SFUI::Vertex& current = input[i];
+        const SFUI::Vertex& next = input[(i + 1) % inputCount];
+        SFUI::Float currentDistance = (vertical ? current.position.x : current.position.y) - edge;
+        SFUI::Float nextDistance = (vertical ? next.position.x : next.position.y) - edge;
+        if (!keepAbove) {
+            currentDistance = -currentDistance;
+            nextDistance = -nextDistance;
+        }
+
+        if (currentDistance >= 0.0f) output[outputCount++] = current;
+        if ((currentDistance >= 0.0f) == (nextDistance >= 0.0f)) continue;
+
+        // Interpolate the Vertex Where the Side Crosses the Edge //
+        SFUI::Float t = currentDistance / (currentDistance - nextDistance);
+        SFUI::Vertex& crossing = output[outputCount++];
+        crossing.position = current.position + (next.position - current.position) * t;
+        crossing.color = SFUI::Color(
+            static_cast<SFUI::UnsignedInt8>(std::lround(current.color.r + (next.color.r - current.color.r) * t)),
+            static_cast<SFUI::UnsignedInt8>(std::lround(current.color.g + (next.color.g - current.color.g) * t)),
+            static_cast<SFUI::UnsignedInt8>(std::lround(current.color.b + (next.color.b - current.color.b) * t)),
+            static_cast<SFUI::UnsignedInt8>(std::lround(current.color.a + (next.color.a - current.color.a) * t))
+        );
+        crossing.texCoords = current.texCoords + (next.texCoords - current.texCoords) * t;
+    }
+    return outputCount;
+}
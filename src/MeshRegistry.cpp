@@ -0,0 +1,131 @@
+/**
+ * @file MeshRegistry.cpp
+ * @brief Implements the SFUI MeshRegistry shared mesh registry.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI MeshRegistry class. It handles:
+ *   - Hashing the geometry inputs of components
+ *   - Finding and registering the meshes built from them
+ *   - Pruning the entries of freed meshes
+ *
+ * It works in conjunction with MeshRegistry.hpp to provide full functionality
+ * for sharing meshes between components with identical geometry.
+ */
+
+
+#include "Base/MeshRegistry.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * @brief Constructor for MeshRegistry.
+ */
+SFUI::MeshRegistry::MeshRegistry() {}
+
+
+/**
+ * @brief Find the mesh built from geometry inputs.
+ *
+ * @param geometryKey The geometry inputs, at the origin.
+ *
+ * @return The shared mesh, or nullptr if none is registered or the inputs are not finite.
+ */
+SFUI::SharedPointer<const SFUI::Mesh> SFUI::MeshRegistry::find(const SFUI::MeshRegistry::GeometryKey& geometryKey) const {
+    if (!isFinite(geometryKey)) return nullptr;
+    auto entry = meshes.find(geometryKey);
+    if (entry == meshes.end()) return nullptr;
+    return entry->second.lock();
+}
+
+
+/**
+ * @brief Register the mesh built from geometry inputs, unless the inputs are not finite.
+ *
+ * A NaN input never compares equal, so its key could never be found again, and would
+ * only add an entry on every lookup. Expired entries are pruned once the registry has
+ * doubled in size since the last pruning.
+ *
+ * @param geometryKey The geometry inputs, at the origin.
+ * @param mesh The mesh built from the inputs.
+ */
+SFUI::Void SFUI::MeshRegistry::insert(const SFUI::MeshRegistry::GeometryKey& geometryKey, const SFUI::SharedPointer<const SFUI::Mesh>& mesh) {
+    if (!isFinite(geometryKey)) return;
+    meshes[geometryKey] = mesh;
+
+    if (meshes.size() >= pruneSize) {
+        std::erase_if(meshes, [](const auto& entry) { return entry.second.expired(); });
+        pruneSize = std::max(MIN_PRUNE_SIZE, 2 * meshes.size());
+    }
+}
+
+
+/**
+ * @brief Get the number of registered meshes still used by a component.
+ *
+ * @return The number of shared meshes.
+ */
+SFUI::Size SFUI::MeshRegistry::getMeshCount() const {
+    return static_cast<SFUI::Size>(std::count_if(meshes.begin(), meshes.end(), [](const auto& entry) { return !entry.second.expired(); }));
+}
+
+
+/**
+ * @brief Check if every geometry input is finite, which a key must be to equal itself.
+ *
+ * @param geometryKey The geometry inputs.
+ *
+ * @return True if no input is infinite or NaN, false otherwise.
+ */
+SFUI::Bool SFUI::MeshRegistry::isFinite(const SFUI::MeshRegistry::GeometryKey& geometryKey) {
+    return std::isfinite(geometryKey.size.x) && std::isfinite(geometryKey.size.y) &&
+        std::isfinite(geometryKey.cornerRadius.x) && std::isfinite(geometryKey.cornerRadius.y) &&
+        std::isfinite(geometryKey.cornerRadius.z) && std::isfinite(geometryKey.cornerRadius.w) &&
+        std::isfinite(geometryKey.borderWidth) &&
+        std::isfinite(geometryKey.shadowOffset.x) && std::isfinite(geometryKey.shadowOffset.y) &&
+        std::isfinite(geometryKey.shadowRadius) && std::isfinite(geometryKey.arcDetail);
+}
+
+
+/**
+ * @brief Hash the geometry inputs.
+ *
+ * Equal keys hash equally, including zeros of opposite signs, which compare equal.
+ *
+ * @param geometryKey The geometry inputs to hash.
+ *
+ * @return The combined hash of every input.
+ */
+SFUI::Size SFUI::MeshRegistry::GeometryKeyHash::operator()(const SFUI::MeshRegistry::GeometryKey& geometryKey) const {
+    SFUI::Size hash = 0;
+    auto combine = [&hash](auto value) {
+        hash ^= std::hash<decltype(value)>()(value) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    };
+    auto combineFloat = [&combine](SFUI::Float value) {
+        combine(value + 0.0f);
+    };
+    auto combineColor = [&combine](const SFUI::Color& color) {
+        combine((static_cast<SFUI::UnsignedInt32>(color.r) << 24) | (color.g << 16) | (color.b << 8) | color.a);
+    };
+    combineFloat(geometryKey.size.x);
+    combineFloat(geometryKey.size.y);
+    combine(geometryKey.position.x);
+    combine(geometryKey.position.y);
+    combineFloat(geometryKey.cornerRadius.x);
+    combineFloat(geometryKey.cornerRadius.y);
+    combineFloat(geometryKey.cornerRadius.z);
+    combineFloat(geometryKey.cornerRadius.w);
+    combineFloat(geometryKey.borderWidth);
+    combineColor(geometryKey.fillColor);
+    combineColor(geometryKey.borderColor);
+    combineFloat(geometryKey.shadowOffset.x);
+    combineFloat(geometryKey.shadowOffset.y);
+    combineFloat(geometryKey.shadowRadius);
+    combineColor(geometryKey.shadowFillColor);
+    combineFloat(geometryKey.arcDetail);
+    combine(geometryKey.shadowRings);
+    return hash;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file QualityController.cpp
+ * @brief Implements the SFUI QualityController frame budget controller.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI QualityController class. It handles:
+ *   - Smoothing the measured cost of each frame
+ *   - Reducing the quality level while frames are over budget
+ *   - Restoring the quality level once frames have headroom again
+ *
+ * It works in conjunction with QualityController.hpp to provide full functionality
+ * for adapting the rendering quality to a frame budget.
+ */
+
+
+#include "Base/QualityController.hpp"
+#include <algorithm>
+
+
+/**
+ * @brief Default frame budget, for 60 frames per second.
+ */
+const SFUI::Time SFUI::QualityController::DEFAULT_BUDGET = sf::microseconds(16667);
+
+
+/**
+ * @brief Constructor for QualityController.
+ */
+SFUI::QualityController::QualityController() :
+    budget(DEFAULT_BUDGET)
+{}
+
+
+/**
+ * @brief Set the frame budget.
+ *
+ * @param budget The largest frame cost allowed.
+ */
+SFUI::Void SFUI::QualityController::setBudget(SFUI::Time budget) {
+    this->budget = budget;
+}
+
+
+/**
+ * @brief Go back to full quality and forget the measured frames.
+ */
+SFUI::Void SFUI::QualityController::reset() {
+    level = SFUI::QualityController::Level::Full;
+    averageFrameTime = SFUI::Time::Zero;
+    frameCount = 0;
+    framesOverBudget = 0;
+    framesWithHeadroom = 0;
+    restoreFrames = RESTORE_FRAMES;
+    lastRestoreFrame.reset();
+}
+
+
+/**
+ * @brief Measure a frame, changing the quality level if needed.
+ *
+ * Frames whose smoothed cost is between the headroom and the budget keep the current level,
+ * so a level is only changed after a run of clearly cheap or expensive frames.
+ *
+ * @param frameCost The cost of the frame.
+ *
+ * @return The transition made, or an empty optional if the level did not change.
+ */
+SFUI::Optional<SFUI::QualityController::Transition> SFUI::QualityController::addFrame(SFUI::Time frameCost) {
+    frameCount++;
+    if (frameCount == 1) averageFrameTime = frameCost;
+    else averageFrameTime += (frameCost - averageFrameTime) * SMOOTHING;
+
+    if (averageFrameTime > budget) {
+        framesOverBudget++;
+        framesWithHeadroom = 0;
+    }   else if (averageFrameTime < budget * HEADROOM) {
+        framesWithHeadroom++;
+        framesOverBudget = 0;
+    }   else {
+        framesOverBudget = 0;
+        framesWithHeadroom = 0;
+    }
+
+    SFUI::QualityController::Level previousLevel = level;
+    if (framesOverBudget >= REDUCE_FRAMES && level != SFUI::QualityController::Level::NoShadows) {
+        // A Level Restored Too Early Doubles the Wait Before the Next Restore //
+        if (lastRestoreFrame.has_value() && frameCount - lastRestoreFrame.value() <= restoreFrames) restoreFrames = std::min(2 * restoreFrames, MAX_RESTORE_FRAMES);
+        else restoreFrames = RESTORE_FRAMES;
+        level = static_cast<SFUI::QualityController::Level>(static_cast<SFUI::Int>(level) + 1);
+    }   else if (framesWithHeadroom >= restoreFrames && level != SFUI::QualityController::Level::Full) {
+        level = static_cast<SFUI::QualityController::Level>(static_cast<SFUI::Int>(level) - 1);
+        lastRestoreFrame = frameCount;
+    }   else {
+        return std::nullopt;
+    }
+
+    framesOverBudget = 0;
+    framesWithHeadroom = 0;
+    return SFUI::QualityController::Transition{previousLevel, level, averageFrameTime, budget};
+}
+
+
+/**
+ * @brief Get the current quality level.
+ *
+ * @return The current quality level.
+ */
+SFUI::QualityController::Level SFUI::QualityController::getLevel() const {
+    return level;
+}
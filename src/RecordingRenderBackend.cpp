@@ -0,0 +1,138 @@
+/**
+ * @file RecordingRenderBackend.cpp
+ * @brief Implements the SFUI RecordingRenderBackend measuring backend.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI RecordingRenderBackend class. It handles:
+ *   - Counting the draw calls and vertices of replayed commands
+ *   - Counting the clip rectangle and texture changes between draw calls
+ *
+ * It works in conjunction with RecordingRenderBackend.hpp to provide full
+ * functionality for measuring the drawing of the UI without a graphics context.
+ */
+
+
+#include "Base/RecordingRenderBackend.hpp"
+
+
+/**
+ * @brief Constructor for RecordingRenderBackend.
+ */
+SFUI::RecordingRenderBackend::RecordingRenderBackend() {}
+
+
+/**
+ * @brief Start counting a replay, without clipping.
+ *
+ * Replays start from an unknown texture, as drawing on the target again rebinds it.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::begin() {
+    statistics.replays++;
+    clip.reset();
+    textureKnown = false;
+}
+
+
+/**
+ * @brief Finish counting a replay.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::end() {
+    clip.reset();
+}
+
+
+/**
+ * @brief Count a change of the clip rectangle.
+ *
+ * @param clipRect The clip rectangle in render target coordinates, or an empty optional to disable clipping.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) {
+    if (clipRect == clip) return;
+    statistics.clipChanges++;
+    clip = clipRect;
+}
+
+
+/**
+ * @brief Count a draw call of triangles from memory.
+ *
+ * @param vertices The first vertex of the triangles.
+ * @param vertexCount The number of vertices.
+ * @param texture The texture of the triangles, or nullptr if untextured.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::drawVertices(const SFUI::Vertex* vertices, SFUI::Size vertexCount, const SFUI::Texture* texture) {
+    countDraw(texture, vertexCount);
+}
+
+
+/**
+ * @brief Count a draw call of triangles from a vertex buffer.
+ *
+ * @param vertexBuffer The vertex buffer holding the triangles.
+ * @param vertexCount The number of vertices drawn from the start of the buffer.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::drawVertexBuffer(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) {
+    countDraw(nullptr, vertexCount);
+}
+
+
+/**
+ * @brief Count a draw call of a drawable.
+ *
+ * The texture and vertices of a drawable are not exposed, so it counts as a texture
+ * change without vertices.
+ *
+ * @param drawable The drawable to draw.
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::drawDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) {
+    statistics.drawCalls++;
+    statistics.textureChanges++;
+    textureKnown = false;
+}
+
+
+/**
+ * @brief Check if the backend draws through an OpenGL context.
+ *
+ * @return False, since nothing is drawn.
+ */
+SFUI::Bool SFUI::RecordingRenderBackend::hasGraphicsContext() const {
+    return false;
+}
+
+
+/**
+ * @brief Zero the statistics.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::reset() {
+    statistics = {};
+}
+
+
+/**
+ * @brief Get the statistics counted since construction or the last reset().
+ *
+ * @return The draw call, vertex, clip change, texture change and replay counts.
+ */
+SFUI::RecordingRenderBackend::Statistics SFUI::RecordingRenderBackend::getStatistics() const {
+    return statistics;
+}
+
+
+/**
+ * @brief Count a draw call and a texture change if its texture differs from the last one.
+ *
+ * @param drawTexture The texture of the draw call, or nullptr if untextured.
+ * @param vertexCount The number of vertices drawn.
+ */
+SFUI::Void SFUI::RecordingRenderBackend::countDraw(const SFUI::Texture* drawTexture, SFUI::Size vertexCount) {
+    statistics.drawCalls++;
+    statistics.vertices += vertexCount;
+    if (!textureKnown || drawTexture != texture) statistics.textureChanges++;
+    texture = drawTexture;
+    textureKnown = true;
+}
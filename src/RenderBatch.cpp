@@ -0,0 +1,452 @@
+/**
+ * @file RenderBatch.cpp
+ * @brief Implements the SFUI RenderBatch draw call batcher.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI RenderBatch class. It handles:
+ *   - Merging triangle geometry into a single vertex stream
+ *   - Merging the clipped glyphs of texts sharing a glyph texture
+ *   - Flushing at clip rectangle and texture boundaries
+ *   - Recording the draw calls and replaying them on a render backend
+ *   - Counting draw calls before and after batching
+ *
+ * It works in conjunction with RenderBatch.hpp to provide full functionality
+ * for drawing the UI tree.
+ */
+
+
+#include "Base/RenderBatch.hpp"
+#include <algorithm>
+
+
+/**
+ * @brief Constructor for RenderBatch.
+ */
+SFUI::RenderBatch::RenderBatch() :
+    vertices(SFUI::PrimitiveType::Triangles)
+{}
+
+
+/**
+ * @brief Start recording a frame of drawing.
+ *
+ * @param backend The backend the recorded frame is replayed on by end(), which must outlive it.
+ * @param batching Whether geometry is merged, or drawn one vertex array at a time.
+ */
+SFUI::Void SFUI::RenderBatch::begin(SFUI::RenderBackend& backend, SFUI::Bool batching) {
+    this->backend = &backend;
+    this->batching = batching;
+    retaining = retained && backend.hasGraphicsContext();
+    commandList.clear();
+    pendingFirstVertex = 0;
+    textTexture = nullptr;
+    pendingMeshSources.clear();
+    retainedSegmentCount = 0;
+    verticesClip.reset();
+    frameStatistics = {};
+    clipStack.reset();
+}
+
+
+/**
+ * @brief Flush the pending geometry and replay the recorded frame on the backend.
+ *
+ * The command list is kept until the next begin(), so the frame can still be inspected.
+ */
+SFUI::Void SFUI::RenderBatch::end() {
+    flush();
+    commandList.replay(*backend);
+
+    // Release the Vertex Buffers of Draw Calls That No Longer Exist //
+    if (retaining && retainedSegments.size() > retainedSegmentCount) retainedSegments.resize(retainedSegmentCount);
+}
+
+
+/**
+ * @brief Enable or disable keeping the batched geometry in GPU vertex buffers between frames.
+ *
+ * @param retained Whether batched geometry is retained on the GPU.
+ */
+SFUI::Void SFUI::RenderBatch::setRetained(SFUI::Bool retained) {
+    this->retained = retained && SFUI::VertexBuffer::isAvailable();
+    if (!this->retained) retainedSegments.clear();
+}
+
+
+/**
+ * @brief Enable or disable cutting appended geometry to the current clip on the CPU.
+ *
+ * @param vertexClipping Whether geometry is clipped on the CPU.
+ */
+SFUI::Void SFUI::RenderBatch::setVertexClipping(SFUI::Bool vertexClipping) {
+    this->vertexClipping = vertexClipping;
+}
+
+
+/**
+ * @brief Restrict the following draws to a rectangle, intersected with the current clip.
+ *
+ * @param clipRect The clip rectangle in render target coordinates.
+ */
+SFUI::Void SFUI::RenderBatch::pushClip(const SFUI::FloatRect& clipRect) {
+    clipStack.push(clipRect);
+}
+
+
+/**
+ * @brief Restore the clip that was active before the last pushClip().
+ */
+SFUI::Void SFUI::RenderBatch::popClip() {
+    clipStack.pop();
+}
+
+
+/**
+ * @brief Append the triangles of a mesh to the batch.
+ *
+ * Geometry under a different clip than the pending geometry starts a new draw call,
+ * since the scissor box can only change between draw calls. With vertex clipping, a mesh
+ * inside the clip is appended as it is, one outside of it is skipped, and only the others
+ * are cut to the clip, so all geometry is drawn unclipped.
+ *
+ * @param mesh The mesh to append.
+ * @param offset The position the mesh is drawn at.
+ */
+SFUI::Void SFUI::RenderBatch::append(const SFUI::Mesh& mesh, const SFUI::Vector2f& offset) {
+    if (mesh.isEmpty()) return;
+    frameStatistics.requestedDrawCalls++;
+    frameStatistics.drawnArea += mesh.getArea();
+    flushText();
+
+    SFUI::Optional<SFUI::FloatRect> clip = clipStack.getClip();
+    SFUI::Optional<SFUI::FloatRect> meshClip;
+    if (vertexClipping && clip.has_value()) {
+        SFUI::FloatRect meshBounds = mesh.getBounds();
+        meshBounds.position += sf::Vector2f(offset);
+        if (!clip->findIntersection(meshBounds).has_value()) return;
+        if (meshBounds.position.x < clip->position.x || meshBounds.position.y < clip->position.y ||
+            meshBounds.position.x + meshBounds.size.x > clip->position.x + clip->size.x ||
+            meshBounds.position.y + meshBounds.size.y > clip->position.y + clip->size.y) meshClip = clip;
+        clip.reset();
+    }
+
+    if (hasPendingGeometry() && verticesClip != clip) flush();
+    verticesClip = clip;
+    if (retaining) pendingMeshSources.push_back({&mesh, mesh.getVersion(), offset, meshClip});
+    else if (meshClip.has_value()) mesh.appendClippedTo(commandList.getVertices(), meshClip.value(), offset);
+    else mesh.appendTo(commandList.getVertices(), offset);
+    if (!batching) flush();
+}
+
+
+/**
+ * @brief Append the glyphs of a text to the batch, clipped on the CPU to the current clip.
+ *
+ * The glyphs are laid out the same way sf::Text lays them out. Since the supported texts
+ * are only translated and scaled, their glyph quads stay axis-aligned, and clipping them
+ * is exact: the quad is cut to the clip and its texture coordinates are cut in proportion.
+ * Reading the glyphs may rasterize and upload them, so the text is drawn as it is when the
+ * backend has no OpenGL context.
+ *
+ * @param text The text to append.
+ */
+SFUI::Void SFUI::RenderBatch::appendText(const SFUI::Text& text) {
+    SFUI::UnsignedInt32 unsupportedStyles = SFUI::Text::Italic | SFUI::Text::Underlined | SFUI::Text::StrikeThrough;
+    if (!backend->hasGraphicsContext() || (text.getStyle() & unsupportedStyles) != 0 || text.getOutlineThickness() != 0.0f || text.getRotation().asDegrees() != 0.0f ||
+        text.getScale().x <= 0.0f || text.getScale().y <= 0.0f) {
+        draw(text);
+        return;
+    }
+
+    const SFUI::Font& font = text.getFont();
+    SFUI::UnsignedInt characterSize = text.getCharacterSize();
+    const SFUI::Texture* texture = &font.getTexture(characterSize);
+    if (hasPendingGeometry() || (textTexture && textTexture != texture)) flush();
+    frameStatistics.requestedDrawCalls++;
+    textTexture = texture;
+
+    // Glyph Layout of sf::Text //
+    SFUI::Bool isBold = (text.getStyle() & SFUI::Text::Bold) != 0;
+    SFUI::Float whitespaceWidth = font.getGlyph(U' ', characterSize, isBold).advance;
+    SFUI::Float letterSpacing = (whitespaceWidth / 3.0f) * (text.getLetterSpacing() - 1.0f);
+    whitespaceWidth += letterSpacing;
+    SFUI::Float lineSpacing = font.getLineSpacing(characterSize) * text.getLineSpacing();
+    SFUI::Float x = 0.0f;
+    SFUI::Float y = static_cast<SFUI::Float>(characterSize);
+    SFUI::Optional<SFUI::FloatRect> clip = clipStack.getClip();
+    const SFUI::Transform& transform = text.getTransform();
+
+    const sf::String& string = text.getString();
+    char32_t previousCharacter = 0;
+    for (SFUI::Size i = 0; i < string.getSize(); i++) {
+        char32_t character = string[i];
+        if (character == U'\r') continue;
+        x += font.getKerning(previousCharacter, character, characterSize, isBold);
+        previousCharacter = character;
+
+        if (character == U' ') {
+            x += whitespaceWidth;
+            continue;
+        }   else if (character == U'\t') {
+            x += whitespaceWidth * 4.0f;
+            continue;
+        }   else if (character == U'\n') {
+            y += lineSpacing;
+            x = 0.0f;
+            continue;
+        }
+
+        const SFUI::Glyph& glyph = font.getGlyph(character, characterSize, isBold);
+        appendGlyphQuad(transform, {x, y}, glyph, text.getFillColor(), clip);
+        x += glyph.advance + letterSpacing;
+    }
+    if (!batching) flush();
+}
+
+
+/**
+ * @brief Draw a textured drawable, flushing the pending geometry first.
+ *
+ * @param drawable The text or other drawable to draw, which must outlive end().
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::RenderBatch::draw(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) {
+    flush();
+    frameStatistics.requestedDrawCalls++;
+    frameStatistics.issuedDrawCalls++;
+    commandList.setClip(clipStack.getClip());
+    commandList.addDrawable(drawable, renderStates);
+}
+
+
+/**
+ * @brief Draw a copy of a sprite, flushing the pending geometry first.
+ *
+ * The sprite is copied into the command list, so it may be a temporary.
+ *
+ * @param sprite The sprite to draw.
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::RenderBatch::draw(const SFUI::Sprite& sprite, const SFUI::RenderStates& renderStates) {
+    flush();
+    frameStatistics.requestedDrawCalls++;
+    frameStatistics.issuedDrawCalls++;
+    commandList.setClip(clipStack.getClip());
+    commandList.addSprite(sprite, renderStates);
+}
+
+
+/**
+ * @brief Count components skipped because they lie outside of the current clip.
+ *
+ * @param componentCount The number of culled components.
+ */
+SFUI::Void SFUI::RenderBatch::countCulled(SFUI::Size componentCount) {
+    frameStatistics.culledComponents += componentCount;
+}
+
+
+/**
+ * @brief Count a component skipped because opaque components drawn after it cover it.
+ */
+SFUI::Void SFUI::RenderBatch::countOccluded() {
+    frameStatistics.occludedComponents++;
+}
+
+
+/**
+ * @brief Get the current clip rectangle, used to cull components.
+ *
+ * @return The effective clip, or an empty optional if unclipped.
+ */
+SFUI::Optional<SFUI::FloatRect> SFUI::RenderBatch::getClip() const {
+    return clipStack.getClip();
+}
+
+
+/**
+ * @brief Get the statistics counted since the last begin().
+ *
+ * @return The draw call counts, culled and occluded component counts, uploaded vertex count and drawn geometry area.
+ */
+SFUI::RenderBatch::FrameStatistics SFUI::RenderBatch::getFrameStatistics() const {
+    return frameStatistics;
+}
+
+
+/**
+ * @brief Get the commands recorded since the last begin().
+ *
+ * @return The command list, replayed and kept until the next begin().
+ */
+const SFUI::RenderCommandList& SFUI::RenderBatch::getCommandList() const {
+    return commandList;
+}
+
+
+/**
+ * @brief Check if geometry is waiting to be drawn.
+ *
+ * @return True if a draw call is pending, false otherwise.
+ */
+SFUI::Bool SFUI::RenderBatch::hasPendingGeometry() const {
+    return (!textTexture && commandList.getVertexCount() > pendingFirstVertex) || !pendingMeshSources.empty();
+}
+
+
+/**
+ * @brief Check if glyph quads are waiting to be drawn.
+ *
+ * @return True if a text draw call is pending, false otherwise.
+ */
+SFUI::Bool SFUI::RenderBatch::hasPendingText() const {
+    return textTexture && commandList.getVertexCount() > pendingFirstVertex;
+}
+
+
+/**
+ * @brief Record the pending glyph quads without a clip, since they are already clipped.
+ *
+ * The glyph texture is forgotten even if every glyph was clipped away, so the following
+ * geometry is not mistaken for glyph quads.
+ */
+SFUI::Void SFUI::RenderBatch::flushText() {
+    if (hasPendingText()) {
+        frameStatistics.issuedDrawCalls++;
+        frameStatistics.uploadedVertices += commandList.getVertexCount() - pendingFirstVertex;
+        commandList.setClip(std::nullopt);
+        commandList.addText(pendingFirstVertex, textTexture);
+        pendingFirstVertex = commandList.getVertexCount();
+    }
+    textTexture = nullptr;
+}
+
+
+/**
+ * @brief Append the quad of a glyph, clipped to a rectangle.
+ *
+ * The quad is padded by a pixel on every side, matching sf::Text, so that glyph edges are
+ * not cut by texture filtering.
+ *
+ * @param transform The transform of the text.
+ * @param position The position of the glyph's origin in the text.
+ * @param glyph The glyph to append.
+ * @param color The fill color of the text.
+ * @param clip The clip rectangle, or an empty optional if unclipped.
+ */
+SFUI::Void SFUI::RenderBatch::appendGlyphQuad(const SFUI::Transform& transform, const SFUI::Vector2f& position, const SFUI::Glyph& glyph, const SFUI::Color& color, const SFUI::Optional<SFUI::FloatRect>& clip) {
+    constexpr SFUI::Float padding = 1.0f;
+    sf::Vector2f topLeft = transform.transformPoint({position.x + glyph.bounds.position.x - padding, position.y + glyph.bounds.position.y - padding});
+    sf::Vector2f bottomRight = transform.transformPoint({position.x + glyph.bounds.position.x + glyph.bounds.size.x + padding, position.y + glyph.bounds.position.y + glyph.bounds.size.y + padding});
+    SFUI::Float left = topLeft.x, top = topLeft.y, right = bottomRight.x, bottom = bottomRight.y;
+    SFUI::Float u1 = static_cast<SFUI::Float>(glyph.textureRect.position.x) - padding;
+    SFUI::Float v1 = static_cast<SFUI::Float>(glyph.textureRect.position.y) - padding;
+    SFUI::Float u2 = static_cast<SFUI::Float>(glyph.textureRect.position.x + glyph.textureRect.size.x) + padding;
+    SFUI::Float v2 = static_cast<SFUI::Float>(glyph.textureRect.position.y + glyph.textureRect.size.y) + padding;
+
+    // Cut the Quad and Its Texture Coordinates by the Same Fractions //
+    if (clip.has_value()) {
+        SFUI::Float clippedLeft = std::max(left, clip->position.x);
+        SFUI::Float clippedTop = std::max(top, clip->position.y);
+        SFUI::Float clippedRight = std::min(right, clip->position.x + clip->size.x);
+        SFUI::Float clippedBottom = std::min(bottom, clip->position.y + clip->size.y);
+        if (clippedLeft >= clippedRight || clippedTop >= clippedBottom) return;
+
+        SFUI::Float uScale = (u2 - u1) / (right - left);
+        SFUI::Float vScale = (v2 - v1) / (bottom - top);
+        u2 = u1 + (clippedRight - left) * uScale;
+        u1 = u1 + (clippedLeft - left) * uScale;
+        v2 = v1 + (clippedBottom - top) * vScale;
+        v1 = v1 + (clippedTop - top) * vScale;
+        left = clippedLeft;
+        top = clippedTop;
+        right = clippedRight;
+        bottom = clippedBottom;
+    }
+
+    SFUI::VertexArray& textVertices = commandList.getVertices();
+    textVertices.append({{left, top}, color, {u1, v1}});
+    textVertices.append({{right, top}, color, {u2, v1}});
+    textVertices.append({{left, bottom}, color, {u1, v2}});
+    textVertices.append({{left, bottom}, color, {u1, v2}});
+    textVertices.append({{right, top}, color, {u2, v1}});
+    textVertices.append({{right, bottom}, color, {u2, v2}});
+}
+
+
+/**
+ * @brief Record the pending geometry with its clip rectangle.
+ */
+SFUI::Void SFUI::RenderBatch::flush() {
+    flushText();
+    if (!hasPendingGeometry()) return;
+    frameStatistics.issuedDrawCalls++;
+    commandList.setClip(verticesClip);
+    if (retaining) {
+        flushRetained();
+        return;
+    }
+    frameStatistics.uploadedVertices += commandList.getVertexCount() - pendingFirstVertex;
+    commandList.addGeometry(pendingFirstVertex);
+    pendingFirstVertex = commandList.getVertexCount();
+}
+
+
+/**
+ * @brief Record the pending meshes as drawn from a retained vertex buffer, uploading them only if they changed.
+ *
+ * Draw calls are matched with the previous frame by their position in the frame. A draw call
+ * made of the same meshes at the same versions is drawn straight from its vertex buffer. A
+ * buffer uploaded on consecutive frames is recreated with dynamic usage, and one that stays
+ * unchanged returns to static usage on its next upload. Uploads happen while recording, so
+ * retained mode needs the backend's OpenGL context. If the buffer cannot be created or updated,
+ * the draw call falls back to the client-side vertices of the command list for that frame.
+ */
+SFUI::Void SFUI::RenderBatch::flushRetained() {
+    if (retainedSegmentCount == retainedSegments.size()) retainedSegments.push_back(std::make_unique<SFUI::RenderBatch::RetainedSegment>());
+    SFUI::RenderBatch::RetainedSegment& segment = *retainedSegments[retainedSegmentCount++];
+
+    if (segment.meshSources != pendingMeshSources) {
+        vertices.clear();
+        for (const SFUI::RenderBatch::MeshSource& meshSource : pendingMeshSources) {
+            if (meshSource.clip.has_value()) meshSource.mesh->appendClippedTo(vertices, meshSource.clip.value(), meshSource.offset);
+            else meshSource.mesh->appendTo(vertices, meshSource.offset);
+        }
+        SFUI::Size vertexCount = vertices.getVertexCount();
+
+        segment.consecutiveUploads++;
+        SFUI::VertexBuffer::Usage usage = segment.consecutiveUploads > 1 ? SFUI::VertexBuffer::Usage::Dynamic : SFUI::VertexBuffer::Usage::Static;
+        SFUI::Bool uploaded = true;
+        if (vertexCount > segment.vertexBuffer.getVertexCount() || usage != segment.vertexBuffer.getUsage()) {
+            segment.vertexBuffer.setUsage(usage);
+            uploaded = segment.vertexBuffer.create(vertexCount);
+        }
+        if (uploaded && vertexCount > 0) uploaded = segment.vertexBuffer.update(&vertices[0], vertexCount, 0);
+        frameStatistics.uploadedVertices += vertexCount;
+
+        // A Failed Upload Leaves the Buffer Stale, so the Meshes Are Drawn From Client-Side Vertices and Uploaded Again Next Frame //
+        if (!uploaded) {
+            segment.meshSources.clear();
+            segment.vertexCount = 0;
+            SFUI::VertexArray& commandVertices = commandList.getVertices();
+            for (SFUI::Size i = 0; i < vertexCount; i++) commandVertices.append(vertices[i]);
+            vertices.clear();
+            commandList.addGeometry(pendingFirstVertex);
+            pendingFirstVertex = commandList.getVertexCount();
+            pendingMeshSources.clear();
+            return;
+        }
+        segment.vertexCount = vertexCount;
+        segment.meshSources = pendingMeshSources;
+        vertices.clear();
+    }   else {
+        segment.consecutiveUploads = 0;
+    }
+
+    // Meshes Clipped Away Entirely Leave Nothing to Draw //
+    if (segment.vertexCount > 0) commandList.addRetainedGeometry(segment.vertexBuffer, segment.vertexCount);
+    pendingMeshSources.clear();
+}
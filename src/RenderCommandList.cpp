@@ -0,0 +1,183 @@
+/**
+ * @file RenderCommandList.cpp
+ * @brief Implements the SFUI RenderCommandList draw command list.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI RenderCommandList class. It handles:
+ *   - Recording geometry spans, text spans, sprites and clip changes
+ *   - Owning the vertices and sprite copies of the recorded commands
+ *   - Replaying the commands in order on a render backend
+ *
+ * It works in conjunction with RenderCommandList.hpp to provide full
+ * functionality for recording the drawing of the UI.
+ */
+
+
+#include "Base/RenderCommandList.hpp"
+
+
+/**
+ * @brief Constructor for RenderCommandList.
+ */
+SFUI::RenderCommandList::RenderCommandList() :
+    vertices(SFUI::PrimitiveType::Triangles)
+{}
+
+
+/**
+ * @brief Remove all commands and vertices, keeping the allocated memory.
+ */
+SFUI::Void SFUI::RenderCommandList::clear() {
+    commands.clear();
+    vertices.clear();
+    sprites.clear();
+    clip.reset();
+}
+
+
+/**
+ * @brief Get the vertex store the geometry and text spans are appended to.
+ *
+ * @return The triangle vertices in render target coordinates.
+ */
+SFUI::VertexArray& SFUI::RenderCommandList::getVertices() {
+    return vertices;
+}
+
+
+/**
+ * @brief Get the number of vertices in the vertex store.
+ *
+ * @return The vertex count.
+ */
+SFUI::Size SFUI::RenderCommandList::getVertexCount() const {
+    return vertices.getVertexCount();
+}
+
+
+/**
+ * @brief Record a change of the clip rectangle, unless it is already the current one.
+ *
+ * @param clipRect The clip rectangle in render target coordinates, or an empty optional to disable clipping.
+ */
+SFUI::Void SFUI::RenderCommandList::setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) {
+    if (clipRect == clip) return;
+    clip = clipRect;
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::Clip;
+    command.clip = clipRect;
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Record untextured triangles, from a vertex of the store to its end.
+ *
+ * @param firstVertex The first vertex of the span in the vertex store.
+ */
+SFUI::Void SFUI::RenderCommandList::addGeometry(SFUI::Size firstVertex) {
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::Geometry;
+    command.firstVertex = firstVertex;
+    command.vertexCount = vertices.getVertexCount() - firstVertex;
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Record triangles kept in a vertex buffer.
+ *
+ * @param vertexBuffer The vertex buffer holding the triangles, which must outlive the replay.
+ * @param vertexCount The number of vertices drawn from the start of the buffer.
+ */
+SFUI::Void SFUI::RenderCommandList::addRetainedGeometry(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) {
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::RetainedGeometry;
+    command.vertexBuffer = &vertexBuffer;
+    command.vertexCount = vertexCount;
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Record glyph quads, from a vertex of the store to its end.
+ *
+ * @param firstVertex The first vertex of the span in the vertex store.
+ * @param texture The glyph texture of the quads.
+ */
+SFUI::Void SFUI::RenderCommandList::addText(SFUI::Size firstVertex, const SFUI::Texture* texture) {
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::Text;
+    command.firstVertex = firstVertex;
+    command.vertexCount = vertices.getVertexCount() - firstVertex;
+    command.texture = texture;
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Record a copy of a sprite.
+ *
+ * @param sprite The sprite to draw.
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::RenderCommandList::addSprite(const SFUI::Sprite& sprite, const SFUI::RenderStates& renderStates) {
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::Sprite;
+    command.spriteIndex = sprites.size();
+    command.renderStates = renderStates;
+    sprites.push_back(sprite);
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Record a drawable by reference.
+ *
+ * @param drawable The drawable to draw, which must outlive the replay.
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::RenderCommandList::addDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) {
+    SFUI::RenderCommandList::Command command;
+    command.type = SFUI::RenderCommandList::CommandType::Drawable;
+    command.drawable = &drawable;
+    command.renderStates = renderStates;
+    commands.push_back(command);
+}
+
+
+/**
+ * @brief Get the recorded commands.
+ *
+ * @return The commands in drawing order.
+ */
+const SFUI::Vector<SFUI::RenderCommandList::Command>& SFUI::RenderCommandList::getCommands() const {
+    return commands;
+}
+
+
+/**
+ * @brief Replay the commands in order on a render backend.
+ *
+ * @param backend The backend receiving the commands.
+ */
+SFUI::Void SFUI::RenderCommandList::replay(SFUI::RenderBackend& backend) const {
+    backend.begin();
+    for (const SFUI::RenderCommandList::Command& command : commands) {
+        if (command.type == SFUI::RenderCommandList::CommandType::Clip) {
+            backend.setClip(command.clip);
+        }   else if (command.type == SFUI::RenderCommandList::CommandType::Geometry || command.type == SFUI::RenderCommandList::CommandType::Text) {
+            backend.drawVertices(&vertices[command.firstVertex], command.vertexCount, command.texture);
+        }   else if (command.type == SFUI::RenderCommandList::CommandType::RetainedGeometry) {
+            backend.drawVertexBuffer(*command.vertexBuffer, command.vertexCount);
+        }   else if (command.type == SFUI::RenderCommandList::CommandType::Sprite) {
+            backend.drawDrawable(sprites[command.spriteIndex], command.renderStates);
+        }   else {
+            backend.drawDrawable(*command.drawable, command.renderStates);
+        }
+    }
+    backend.end();
+}
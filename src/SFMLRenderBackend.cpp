@@ -0,0 +1,103 @@
+/**
+ * @file SFMLRenderBackend.cpp
+ * @brief Implements the SFUI SFMLRenderBackend render target backend.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the function definitions and internal logic for the
+ * SFUI SFMLRenderBackend class. It handles:
+ *   - Activating the render target a command list is replayed on
+ *   - Applying clip rectangles as view scissors
+ *   - Issuing the SFML draw calls of replayed commands
+ *
+ * It works in conjunction with SFMLRenderBackend.hpp to provide full
+ * functionality for drawing the UI on an SFML render target.
+ */
+
+
+#include "Base/SFMLRenderBackend.hpp"
+
+
+/**
+ * @brief Constructor for SFMLRenderBackend.
+ *
+ * @param drawTarget The target to draw on.
+ */
+SFUI::SFMLRenderBackend::SFMLRenderBackend(SFUI::RenderTarget& drawTarget) :
+    drawTarget(drawTarget)
+{}
+
+
+/**
+ * @brief Activate the render target and remember its view.
+ *
+ * Clips are set as the scissor of the view, which SFML applies again after other targets
+ * were drawn on, so no scissor state has to be reset here.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::begin() {
+    static_cast<SFUI::Void>(drawTarget.setActive(true));
+    baseView = drawTarget.getView();
+}
+
+
+/**
+ * @brief Restore the view the render target had when the replay began.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::end() {
+    drawTarget.setView(baseView);
+}
+
+
+/**
+ * @brief Set the scissor of the render target's view.
+ *
+ * @param clipRect The clip rectangle in render target coordinates, or an empty optional to disable clipping.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::setClip(const SFUI::Optional<SFUI::FloatRect>& clipRect) {
+    SFUI::ClipStack::apply(drawTarget, clipRect);
+}
+
+
+/**
+ * @brief Draw triangles from memory.
+ *
+ * @param vertices The first vertex of the triangles.
+ * @param vertexCount The number of vertices.
+ * @param texture The texture of the triangles, or nullptr if untextured.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::drawVertices(const SFUI::Vertex* vertices, SFUI::Size vertexCount, const SFUI::Texture* texture) {
+    drawTarget.draw(vertices, vertexCount, SFUI::PrimitiveType::Triangles, SFUI::RenderStates(texture));
+}
+
+
+/**
+ * @brief Draw triangles from a vertex buffer.
+ *
+ * @param vertexBuffer The vertex buffer holding the triangles.
+ * @param vertexCount The number of vertices drawn from the start of the buffer.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::drawVertexBuffer(const SFUI::VertexBuffer& vertexBuffer, SFUI::Size vertexCount) {
+    drawTarget.draw(vertexBuffer, 0, vertexCount);
+}
+
+
+/**
+ * @brief Draw a drawable, such as a sprite or a text.
+ *
+ * @param drawable The drawable to draw.
+ * @param renderStates The render states to draw with.
+ */
+SFUI::Void SFUI::SFMLRenderBackend::drawDrawable(const SFUI::Drawable& drawable, const SFUI::RenderStates& renderStates) {
+    drawTarget.draw(drawable, renderStates);
+}
+
+
+/**
+ * @brief Check if the backend draws through an OpenGL context.
+ *
+ * @return True, since the render target owns one.
+ */
+SFUI::Bool SFUI::SFMLRenderBackend::hasGraphicsContext() const {
+    return true;
+}
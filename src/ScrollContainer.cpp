@@ -53,6 +53,7 @@ SFUI::Void SFUI::ScrollContainer::handleEvent(const SFUI::Event& event) {
         const SFUI::Vector2i mousePosition = SFUI::Vector2i(mouseWheelScrolledEvent->position.x, mouseWheelScrolledEvent->position.y);
         SFUI::Bool scrollAreaHovered = isMouseHovered(mousePosition);
         if (!scrollAreaHovered) return;
+        const SFUI::Vector2f previousScrollOffset = scrollOffset;
 
         if (mouseWheelScrolledEvent->wheel == sf::Mouse::Wheel::Vertical) {
             if (computedScrollContainerStyle.scrollDirection == "vertical" || computedScrollContainerStyle.scrollDirection == "both") {
@@ -83,6 +84,7 @@ SFUI::Void SFUI::ScrollContainer::handleEvent(const SFUI::Event& event) {
                 }
             }
         }
+        if (scrollOffset != previousScrollOffset) markChildrenDirty();
     }
 }
 
@@ -91,9 +93,9 @@ SFUI::Void SFUI::ScrollContainer::handleEvent(const SFUI::Event& event) {
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::ScrollContainer::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
+    if (commitProps(committedStyle, this->style)) markChildrenDirty();
 }
 
 
@@ -104,17 +106,26 @@ SFUI::Void SFUI::ScrollContainer::preUpdate() {
  */
 SFUI::Void SFUI::ScrollContainer::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeColors();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    computeAlignPrimary();
-    computeScrollDynamics();
-    computeChildrenScrollPosition();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeColors();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        computeAlignPrimary();
+        computeScrollDynamics();
+        computeChildrenScrollPosition();
+        updateChildren();
+    }
+    clearDirtyFlags();
 }
 
 
@@ -125,12 +136,7 @@ SFUI::Void SFUI::ScrollContainer::update(const SFUI::Vector2u renderTargetSize)
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::ScrollContainer::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
+    drawMesh(drawTarget);
 }
 
 
@@ -152,17 +158,36 @@ SFUI::Void SFUI::ScrollContainer::drawOverlay(SFUI::RenderTarget& drawTarget, SF
  * @brief Compute primary alignment for the scroll container.
  */
 SFUI::Void SFUI::ScrollContainer::computeAlignPrimary() {
-    SFUI::String tempAlignPrimary = layout.alignPrimary;
-    std::transform(tempAlignPrimary.begin(), tempAlignPrimary.end(), tempAlignPrimary.begin(), [](unsigned char c) {
-        return std::tolower(c);
-    });
-
-    if (tempAlignPrimary == "start") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::Start;
-    else if (tempAlignPrimary == "end") computedLayout.alignPrimary = SFUI::Component::AlignPrimary::End;
+    if (compiledLayout.alignPrimary == SFUI::Component::AlignPrimary::End) computedLayout.alignPrimary = SFUI::Component::AlignPrimary::End;
     else computedLayout.alignPrimary = SFUI::Component::AlignPrimary::Start;
 }
 
 
+/**
+ * @brief Check if the scroll container must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return True if the scroll container is hovered, false otherwise.
+ */
+SFUI::Bool SFUI::ScrollContainer::isMouseEngaged() const {
+    return isHovered;
+}
+
+
+/**
+ * @brief Get the event types consumed by the scroll container.
+ *
+ * @return Mouse events only.
+ */
+SFUI::Component::EventSubscriptions SFUI::ScrollContainer::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = true;
+    subscriptions.keyboard = false;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Compute scroll dynamics for the scroll container.
  */
@@ -182,12 +207,10 @@ SFUI::Void SFUI::ScrollContainer::computeScrollDynamics() {
     else computedScrollContainerStyle.scrollSpeedFactor = style.scrollSpeedFactor;
 
     // Maximum Scroll Offset //
-    const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& children = this->getChildren();
     SFUI::Vector2f contentSize = {0.0f, 0.0f};
-    for (const auto& child : children) {
-        SFUI::Vector4f childMargin = child->getMargin();
-        contentSize.x += (child->getSize().x + (childMargin.x + childMargin.y));
-        contentSize.y += (child->getSize().y + (childMargin.z + childMargin.w));
+    for (const SFUI::Component::ComputedChildLayout& childLayout : computedChildrenLayout) {
+        contentSize.x += (childLayout.size.x + (childLayout.margin.x + childLayout.margin.y));
+        contentSize.y += (childLayout.size.y + (childLayout.margin.z + childLayout.margin.w));
     }
     maxScrollOffset = {contentSize.x - computedLayout.size.x, contentSize.y - computedLayout.size.y};
     if (maxScrollOffset.x < 0.0f) maxScrollOffset.x = 0.0f;
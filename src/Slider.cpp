@@ -38,6 +38,11 @@ SFUI::Slider::Slider(SFUI::String componentID) :
  * @param event The event to handle.
  */
 SFUI::Void SFUI::Slider::handleEvent(const SFUI::Event& event) {
+    const SFUI::Array<SFUI::Bool, 7> previousInteraction = {
+        isTrackHovered, isThumbHovered, isTrackLeftPressed, isTrackRightPressed,
+        isTrackMiddlePressed, isThumbLeftPressed, isSliding
+    };
+    const SFUI::Vector2f previousThumbPosition = thumbUpdatePosition;
     thumb.handleEvent(event);
 
     // Mouse Moved Event Handling //
@@ -127,6 +132,13 @@ SFUI::Void SFUI::Slider::handleEvent(const SFUI::Event& event) {
             }
         }
     }
+
+    // Interaction Changes Affect the Dynamic Colors, Thumb, and Tracks //
+    const SFUI::Array<SFUI::Bool, 7> currentInteraction = {
+        isTrackHovered, isThumbHovered, isTrackLeftPressed, isTrackRightPressed,
+        isTrackMiddlePressed, isThumbLeftPressed, isSliding
+    };
+    if (currentInteraction != previousInteraction || thumbUpdatePosition != previousThumbPosition) markStyleDirty();
 }
 
 
@@ -134,12 +146,21 @@ SFUI::Void SFUI::Slider::handleEvent(const SFUI::Event& event) {
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Slider::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
-    unprogressedTrack.preUpdate();
-    progressedTrack.preUpdate();
-    thumb.preUpdate();
+    SFUI::Bool styleChanged = commitProps(committedStyle, this->style);
+    SFUI::Bool stateChanged = commitProps(committedState, this->state);
+    if (styleChanged) {
+        compiledSliderStyle.thumbWidth = compileDimensionSubProp(style.thumbWidth);
+        compiledSliderStyle.trackWidth = compileDimensionSubProp(style.trackWidth);
+        compiledSliderStyle.trackProgressedWidth.reset();
+        if (style.trackProgressedWidth.has_value())
+            compiledSliderStyle.trackProgressedWidth = compileDimensionSubProp(style.trackProgressedWidth.value());
+    }
+    if (styleChanged || stateChanged) markStyleDirty();
+    preUpdateInnerComponent(unprogressedTrack);
+    preUpdateInnerComponent(progressedTrack);
+    preUpdateInnerComponent(thumb);
 }
 
 
@@ -150,19 +171,28 @@ SFUI::Void SFUI::Slider::preUpdate() {
  */
 SFUI::Void SFUI::Slider::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeColors();
-    computeShadows();
-    computeGraphics();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeColors();
+        computeShadows();
+    }
+    if (dirtyFlags.geometry) {
+        computeGraphics();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeTrackAlign();
     computeValueDynamics();
     computeDynamicColors();
     computeThumb();
     computeTracks();
+    clearDirtyFlags();
 }
 
 
@@ -173,12 +203,7 @@ SFUI::Void SFUI::Slider::update(const SFUI::Vector2u renderTargetSize) {
  * @param window The render window associated with the render target.
  */
 SFUI::Void SFUI::Slider::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    drawTarget.draw(shadowRects);
-    drawTarget.draw(shadowArcs);
-    drawTarget.draw(backgroundRects);
-    drawTarget.draw(backgroundArcs);
-    drawTarget.draw(borderRects);
-    drawTarget.draw(borderArcs);
+    drawMesh(drawTarget);
     unprogressedTrack.draw(drawTarget, window);
     progressedTrack.draw(drawTarget, window);
     thumb.draw(drawTarget, window);
@@ -201,6 +226,88 @@ SFUI::Void SFUI::Slider::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::Rende
 }
 
 
+/**
+ * @brief Draw the slider's geometry and its tracks and thumb through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Slider::drawBatched(SFUI::RenderBatch& renderBatch) {
+    SFUI::Component::drawBatched(renderBatch);
+    unprogressedTrack.drawBatched(renderBatch);
+    progressedTrack.drawBatched(renderBatch);
+    thumb.drawBatched(renderBatch);
+}
+
+
+/**
+ * @brief Draw the slider thumb's overlay pass through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Slider::drawOverlayBatched(SFUI::RenderBatch& renderBatch) {
+    thumb.drawOverlayBatched(renderBatch);
+}
+
+
+/**
+ * @brief Check if the slider must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return True if the slider is hovered, pressed, sliding, or focused, false otherwise.
+ */
+SFUI::Bool SFUI::Slider::isMouseEngaged() const {
+    return isTrackHovered || isThumbHovered || isTrackLeftPressed || isTrackRightPressed || isTrackMiddlePressed || isSliding || state.isFocused || thumb.isMouseEngaged();
+}
+
+
+/**
+ * @brief Check if the slider must receive keyboard and text events.
+ *
+ * @return True if the slider is focused, false otherwise.
+ */
+SFUI::Bool SFUI::Slider::isKeyboardEngaged() const {
+    return state.isFocused;
+}
+
+
+/**
+ * @brief Get the event types consumed by the slider.
+ *
+ * @return Mouse and keyboard events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Slider::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = true;
+    subscriptions.keyboard = true;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
+/**
+ * @brief Get the bounds used to index the slider for mouse event routing.
+ *
+ * The thumb may extend past the slider's layout box, so its bounds are merged in.
+ *
+ * @return The layout box of the slider extended by the bounds of its thumb.
+ */
+SFUI::FloatRect SFUI::Slider::getHitBounds() const {
+    return unionBounds(SFUI::Component::getHitBounds(), thumb.getHitBounds());
+}
+
+
+/**
+ * @brief Get the bounds of everything the slider draws in the UI tree pass.
+ *
+ * @return The draw bounds of the slider extended by the draw bounds of its tracks and thumb.
+ */
+SFUI::FloatRect SFUI::Slider::getDrawBounds() const {
+    SFUI::FloatRect drawBounds = unionBounds(SFUI::Component::getDrawBounds(), unprogressedTrack.getDrawBounds());
+    drawBounds = unionBounds(drawBounds, progressedTrack.getDrawBounds());
+    return unionBounds(drawBounds, thumb.getDrawBounds());
+}
+
+
 /**
  * @brief Compute the alignment of the tracks within its bounding box.
  */
@@ -350,39 +457,9 @@ SFUI::Void SFUI::Slider::computeDynamicColors() {
  */
 SFUI::Void SFUI::Slider::computeThumb() {
     // Thumb Size //
-    SFUI::Vector2f computedThumbSize = {15.0f, 15.0f};
-    if (std::holds_alternative<SFUI::Float>(style.thumbWidth))
-        computedThumbSize.x = std::get<SFUI::Float>(style.thumbWidth);
-    else if (std::holds_alternative<SFUI::String>(style.thumbWidth)) {
-        SFUI::String thumbWidthString = std::get<SFUI::String>(style.thumbWidth);
-        if (thumbWidthString.size() > 1 && thumbWidthString.back() == '%') {
-            thumbWidthString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempThumbWidth = std::stod(thumbWidthString, &index);
-                if (index == thumbWidthString.size()) {
-                    SFUI::Float relativeTrackWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedThumbSize.x = relativeTrackWidthFactor * std::clamp(static_cast<SFUI::Float>(tempThumbWidth) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
-    if (std::holds_alternative<SFUI::Float>(style.thumbWidth))
-        computedThumbSize.y = std::get<SFUI::Float>(style.thumbWidth);
-    else if (std::holds_alternative<SFUI::String>(style.thumbWidth)) {
-        SFUI::String thumbHeightString = std::get<SFUI::String>(style.thumbWidth);
-        if (thumbHeightString.size() > 1 && thumbHeightString.back() == '%') {
-            thumbHeightString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempThumbHeight = std::stod(thumbHeightString, &index);
-                if (index == thumbHeightString.size()) {
-                    SFUI::Float relativeTrackWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedThumbSize.y = relativeTrackWidthFactor * std::clamp(static_cast<SFUI::Float>(tempThumbHeight) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
+    SFUI::Float relativeThumbWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
+    SFUI::Float computedThumbWidth = resolveDimensionSubProp(compiledSliderStyle.thumbWidth, relativeThumbWidthFactor, 0.5f, 15.0f);
+    SFUI::Vector2f computedThumbSize = {computedThumbWidth, computedThumbWidth};
     computedSliderStyle.thumbSize = computedThumbSize;
 
     // Thumb Layout //
@@ -467,7 +544,7 @@ SFUI::Void SFUI::Slider::computeThumb() {
     };
 
     // Update //
-    thumb.update(renderTargetSize);
+    updateInnerComponent(thumb);
 }
 
 
@@ -476,45 +553,13 @@ SFUI::Void SFUI::Slider::computeThumb() {
  */
 SFUI::Void SFUI::Slider::computeTracks() {
     // Master Track Width //
-    SFUI::Float computedTrackWidth = 7.0f;
-    if (std::holds_alternative<SFUI::Float>(style.trackWidth))
-        computedTrackWidth = std::get<SFUI::Float>(style.trackWidth);
-    else if (std::holds_alternative<SFUI::String>(style.trackWidth)) {
-        SFUI::String trackWidthString = std::get<SFUI::String>(style.trackWidth);
-        if (trackWidthString.size() > 1 && trackWidthString.back() == '%') {
-            trackWidthString.pop_back();
-            try {
-                size_t index = 0;
-                SFUI::Double tempTrackWidth = std::stod(trackWidthString, &index);
-                if (index == trackWidthString.size()) {
-                    SFUI::Float relativeTrackWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                    computedTrackWidth = relativeTrackWidthFactor * std::clamp(static_cast<SFUI::Float>(tempTrackWidth) / 100.0f, 0.0f, 0.5f);
-                }
-            }   catch (...) {}
-        }
-    }
+    SFUI::Float relativeTrackWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
+    SFUI::Float computedTrackWidth = resolveDimensionSubProp(compiledSliderStyle.trackWidth, relativeTrackWidthFactor, 0.5f, 7.0f);
 
     // Progressed Track Width //
     SFUI::Float computedProgressedTrackWidth = computedTrackWidth;
-    if (style.trackProgressedWidth.has_value()) {
-        SFUI::Prop::Dimension trackProgressedWidth = style.trackProgressedWidth.value();
-        if (std::holds_alternative<SFUI::Float>(trackProgressedWidth))
-            computedTrackWidth = std::get<SFUI::Float>(trackProgressedWidth);
-        else if (std::holds_alternative<SFUI::String>(trackProgressedWidth)) {
-            SFUI::String trackWidthString = std::get<SFUI::String>(trackProgressedWidth);
-            if (trackWidthString.size() > 1 && trackWidthString.back() == '%') {
-                trackWidthString.pop_back();
-                try {
-                    size_t index = 0;
-                    SFUI::Double tempTrackWidth = std::stod(trackWidthString, &index);
-                    if (index == trackWidthString.size()) {
-                        SFUI::Float relativeTrackWidthFactor = std::min(computedLayout.size.x, computedLayout.size.y);
-                        computedTrackWidth = relativeTrackWidthFactor * std::clamp(static_cast<SFUI::Float>(tempTrackWidth) / 100.0f, 0.0f, 0.5f);
-                    }
-                }   catch (...) {}
-            }
-        }
-    }
+    if (compiledSliderStyle.trackProgressedWidth.has_value())
+        computedTrackWidth = resolveDimensionSubProp(compiledSliderStyle.trackProgressedWidth.value(), relativeTrackWidthFactor, 0.5f, computedTrackWidth);
 
     // Track Size and Positions //
     SFUI::Vector2i thumbPosition = {static_cast<SFUI::Int>(thumbUpdatePosition.x), static_cast<SFUI::Int>(thumbUpdatePosition.y)};
@@ -563,8 +608,8 @@ SFUI::Void SFUI::Slider::computeTracks() {
     progressedTrack.style.cornerRadius = style.trackCornerRadius;
 
     // Update //
-    unprogressedTrack.update(renderTargetSize);
-    progressedTrack.update(renderTargetSize);
+    updateInnerComponent(unprogressedTrack);
+    updateInnerComponent(progressedTrack);
 }
 
 
@@ -109,6 +109,7 @@ SFUI::TextField::TextField(SFUI::String componentID) :
  * @param event The event to handle.
  */
 SFUI::Void SFUI::TextField::handleEvent(const SFUI::Event& event) {
+    const SFUI::UnsignedInt previousCaretIndex = caretIndex;
     background.handleEvent(event);
     inputText.handleEvent(event);
     caret.handleEvent(event);
@@ -146,6 +147,9 @@ SFUI::Void SFUI::TextField::handleEvent(const SFUI::Event& event) {
     else if (const sf::Event::TextEntered* textEnteredEvent = event.getIf<sf::Event::TextEntered>()) {
         if (state.isFocused) insertText(textEnteredEvent->unicode);
     }
+
+    // Caret Movement Affects the Caret and Text Offset //
+    if (caretIndex != previousCaretIndex) markStyleDirty();
 }
 
 
@@ -153,12 +157,15 @@ SFUI::Void SFUI::TextField::handleEvent(const SFUI::Event& event) {
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::TextField::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
-    background.preUpdate();
-    inputText.preUpdate();
-    caret.preUpdate();
+    SFUI::Bool styleChanged = commitProps(committedStyle, this->style);
+    SFUI::Bool stateChanged = commitProps(committedState, this->state);
+    if (styleChanged) compiledTextFieldStyle.textInset = compileUniQuadSubProp(style.textInset);
+    if (styleChanged || stateChanged) markStyleDirty();
+    preUpdateInnerComponent(background);
+    preUpdateInnerComponent(inputText);
+    preUpdateInnerComponent(caret);
 }
 
 
@@ -169,11 +176,17 @@ SFUI::Void SFUI::TextField::preUpdate() {
  */
 SFUI::Void SFUI::TextField::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeLineMode();
     computeBackground();
     computeInputText();
@@ -181,6 +194,10 @@ SFUI::Void SFUI::TextField::update(const SFUI::Vector2u renderTargetSize) {
         computeCaret();
         computeDynamicTextOffset();
     }
+    clearDirtyFlags();
+
+    // Keep Updating While Focused for the Caret Blink Timer //
+    if (state.isFocused) markStyleDirty();
 }
 
 
@@ -213,6 +230,84 @@ SFUI::Void SFUI::TextField::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::Re
 }
 
 
+/**
+ * @brief Draw the text field's inner components through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::TextField::drawBatched(SFUI::RenderBatch& renderBatch) {
+    background.drawBatched(renderBatch);
+    inputText.drawBatched(renderBatch);
+    if (!state.isDisabled && state.isFocused && caretVisible) caret.drawBatched(renderBatch);
+}
+
+
+/**
+ * @brief Draw the text field background's overlay pass through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::TextField::drawOverlayBatched(SFUI::RenderBatch& renderBatch) {
+    background.drawOverlayBatched(renderBatch);
+}
+
+
+/**
+ * @brief Get the bounds of everything the text field draws in the UI tree pass.
+ *
+ * @return The draw bounds of its background, input text and caret.
+ */
+SFUI::FloatRect SFUI::TextField::getDrawBounds() const {
+    SFUI::FloatRect drawBounds = unionBounds(background.getDrawBounds(), inputText.getDrawBounds());
+    return unionBounds(drawBounds, caret.getDrawBounds());
+}
+
+
+/**
+ * @brief Get a rectangle the text field draws fully opaque in the UI tree pass.
+ *
+ * @return The opaque rectangle of its background, or an empty optional if none.
+ */
+SFUI::Optional<SFUI::FloatRect> SFUI::TextField::getOpaqueBounds() const {
+    return background.getOpaqueBounds();
+}
+
+
+/**
+ * @brief Check if the text field must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return True if the text field is focused or its background is engaged, false otherwise.
+ */
+SFUI::Bool SFUI::TextField::isMouseEngaged() const {
+    return state.isFocused || background.isMouseEngaged();
+}
+
+
+/**
+ * @brief Check if the text field must receive keyboard and text events.
+ *
+ * @return True if the text field is focused or its background is engaged, false otherwise.
+ */
+SFUI::Bool SFUI::TextField::isKeyboardEngaged() const {
+    return state.isFocused || background.isKeyboardEngaged();
+}
+
+
+/**
+ * @brief Get the event types consumed by the text field.
+ *
+ * @return Mouse, keyboard, and text events.
+ */
+SFUI::Component::EventSubscriptions SFUI::TextField::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = true;
+    subscriptions.keyboard = true;
+    subscriptions.text = true;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Compute the line mode property.
  */
@@ -314,7 +409,7 @@ SFUI::Void SFUI::TextField::computeBackground() {
     };
 
     // Update //
-    background.update(renderTargetSize);
+    updateInnerComponent(background);
 }
 
 
@@ -323,7 +418,7 @@ SFUI::Void SFUI::TextField::computeBackground() {
  */
 SFUI::Void SFUI::TextField::computeInputText() {
     // Text Inset //
-    SFUI::Vector4f computedTextInset = resolveUniQuadSubProp(computedLayout.size, style.textInset);
+    SFUI::Vector4f computedTextInset = resolveUniQuadSubProp(computedLayout.size, compiledTextFieldStyle.textInset);
     if (computedTextFieldStyle.lineMode == "single") {
         SFUI::Float singleLineVerticalInset = (computedLayout.size.y - (style.textSize * CENTER_TEXT_OFFSET_FACTOR)) / 2.0f;
         computedTextInset.z = computedTextInset.w = singleLineVerticalInset;
@@ -354,7 +449,7 @@ SFUI::Void SFUI::TextField::computeInputText() {
     inputText.style.textOutlineColor = style.textOutlineColor;
 
     // Update //
-    inputText.update(renderTargetSize);
+    updateInnerComponent(inputText);
 }
 
 
@@ -408,7 +503,7 @@ SFUI::Void SFUI::TextField::computeCaret() {
     caret.style.fillColor = style.caretFillColor;
 
     // Update //
-    caret.update(renderTargetSize);
+    updateInnerComponent(caret);
 }
 
 
@@ -443,7 +538,7 @@ SFUI::Void SFUI::TextField::computeDynamicTextOffset() {
 
     if (dynamicUpdateNeeded) {
         inputText.style.textOffset = dynamicTextOffset;
-        inputText.update(renderTargetSize);
+        updateInnerComponent(inputText);
         computeCaret();
     }
 }
@@ -44,10 +44,12 @@ SFUI::Void SFUI::Toggle::handleEvent(const SFUI::Event& event) {
  * @brief Handle the pre updaate updates for the component.
  */
 SFUI::Void SFUI::Toggle::preUpdate() {
-    this->baseLayout = this->layout;
-    this->baseStyle = this->style;
+    commitBaseProps(this->layout, this->style);
     this->baseState = this->state;
-    toggle.preUpdate();
+    SFUI::Bool styleChanged = commitProps(committedStyle, this->style);
+    SFUI::Bool stateChanged = commitProps(committedState, this->state);
+    if (styleChanged || stateChanged) markStyleDirty();
+    preUpdateInnerComponent(toggle);
 }
 
 
@@ -58,14 +60,21 @@ SFUI::Void SFUI::Toggle::preUpdate() {
  */
 SFUI::Void SFUI::Toggle::update(const SFUI::Vector2u renderTargetSize) {
     this->renderTargetSize = renderTargetSize;
-    computeAlignment();
-    computeLayoutBox();
-    computeStyles();
-    computeShadows();
-    computeChildrenLayoutBox();
-    updateChildren();
+    if (dirtyFlags.layout) {
+        computeAlignment();
+        computeLayoutBox();
+    }
+    if (dirtyFlags.style) {
+        computeStyles();
+        computeShadows();
+    }
+    if (dirtyFlags.children) {
+        computeChildrenLayoutBox();
+        updateChildren();
+    }
     computeDynamicColors();
     computeToggle();
+    clearDirtyFlags();
 }
 
 
@@ -96,6 +105,81 @@ SFUI::Void SFUI::Toggle::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::Rende
 }
 
 
+/**
+ * @brief Draw the toggle's switch button through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Toggle::drawBatched(SFUI::RenderBatch& renderBatch) {
+    toggle.drawBatched(renderBatch);
+}
+
+
+/**
+ * @brief Draw the switch button's overlay pass through a render batch.
+ *
+ * @param renderBatch The batch to draw through.
+ */
+SFUI::Void SFUI::Toggle::drawOverlayBatched(SFUI::RenderBatch& renderBatch) {
+    toggle.drawOverlayBatched(renderBatch);
+}
+
+
+/**
+ * @brief Get the bounds of everything the toggle draws in the UI tree pass.
+ *
+ * @return The draw bounds of its switch button.
+ */
+SFUI::FloatRect SFUI::Toggle::getDrawBounds() const {
+    return toggle.getDrawBounds();
+}
+
+
+/**
+ * @brief Get a rectangle the toggle draws fully opaque in the UI tree pass.
+ *
+ * @return The opaque rectangle of its switch button, or an empty optional if none.
+ */
+SFUI::Optional<SFUI::FloatRect> SFUI::Toggle::getOpaqueBounds() const {
+    return toggle.getOpaqueBounds();
+}
+
+
+/**
+ * @brief Check if the toggle must keep receiving mouse events while the cursor is outside of it.
+ *
+ * @return True if the toggle is focused or its switch button is engaged, false otherwise.
+ */
+SFUI::Bool SFUI::Toggle::isMouseEngaged() const {
+    return state.isFocused || toggle.isMouseEngaged();
+}
+
+
+/**
+ * @brief Check if the toggle must receive keyboard and text events.
+ *
+ * @return True if the toggle is focused or its switch button is engaged, false otherwise.
+ */
+SFUI::Bool SFUI::Toggle::isKeyboardEngaged() const {
+    return state.isFocused || toggle.isKeyboardEngaged();
+}
+
+
+/**
+ * @brief Get the event types consumed by the toggle.
+ *
+ * @return Mouse and keyboard events.
+ */
+SFUI::Component::EventSubscriptions SFUI::Toggle::getEventSubscriptions() const {
+    SFUI::Component::EventSubscriptions subscriptions;
+    subscriptions.mouse = true;
+    subscriptions.keyboard = true;
+    subscriptions.text = false;
+    subscriptions.other = false;
+    return subscriptions;
+}
+
+
 /**
  * @brief Compute dynamic colors based on the Toggle's state.
  */
@@ -210,5 +294,5 @@ SFUI::Void SFUI::Toggle::computeToggle() {
     };
 
     // Update //
-    toggle.update(renderTargetSize);
+    updateInnerComponent(toggle);
 }
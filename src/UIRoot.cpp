@@ -8,15 +8,32 @@
  * This file contains the function definitions and internal logic for the
  * SFUI UIRoot class. It handles:
  *   - Root-level event propagation
+ *   - Mouse event routing through a hit-test grid
  *   - Layout computation for child components
  *   - Rendering of the UI tree
+ *   - Caching subtrees as texture layers
+ *   - Compositing the UI tree into a texture redrawn on change
+ *   - Tracking damaged regions for partial redraws
+ *   - Skipping components hidden beneath opaque components
  *
  * It works in conjunction with UIRoot.hpp to provide full functionality
  * for managing UI hierarchies.
  */
 
 
-#include "base/UIRoot.hpp"
+#include "Base/UIRoot.hpp"
+
+
+/**
+ * @brief Blend mode of cached layers and the composite texture, whose colors are premultiplied by alpha blending into a transparent texture.
+ */
+const SFUI::BlendMode SFUI::UIRoot::LAYER_BLEND_MODE = SFUI::BlendMode(SFUI::BlendMode::Factor::One, SFUI::BlendMode::Factor::OneMinusSrcAlpha);
+
+
+/**
+ * @brief Blend mode overwriting the damaged regions of the composite texture with transparency.
+ */
+const SFUI::BlendMode SFUI::UIRoot::DAMAGE_CLEAR_BLEND_MODE = SFUI::BlendMode(SFUI::BlendMode::Factor::One, SFUI::BlendMode::Factor::Zero);
 
 
 /**
@@ -36,30 +53,47 @@ SFUI::UIRoot::UIRoot(SFUI::UniquePointer<SFUI::Component> rootComponent) :
  */
 SFUI::Void SFUI::UIRoot::setRootComponent(SFUI::UniquePointer<SFUI::Component> rootComponent) {
     this->rootComponent = std::move(rootComponent);
+    traversalOrder.clear();
+    if (this->rootComponent) this->rootComponent->treeStructureDirty = true;
+    hitTestGridValid = false;
+    mouseEngagedComponents.clear();
+    keyboardEngagedComponents.clear();
+    otherEventSubscribers.clear();
+    fullDamage = true;
 }
 
 
 /**
- * @brief Handles input events by propagating to all components contained in the UI.
+ * @brief Handles input events by propagating to the components contained in the UI.
+ *
+ * Once the hit-test grid has been built, positioned mouse events are routed through it,
+ * keyboard and text events only reach the engaged components subscribed to them, and
+ * other events only reach their subscribers. Before that, events are propagated to every
+ * component subscribed to them.
  *
  * @param event The input event to handle.
  */
 SFUI::Void SFUI::UIRoot::handleEvent(const SFUI::Event& event) {
     if (!rootComponent) return;
 
-    // Breadth-First Traversal Algorithm for UI Component Drawing //
-    std::deque<SFUI::Component*> childrenQueue;
-    childrenQueue.push_back(rootComponent.get());
-
-    while (!childrenQueue.empty()) {
-        SFUI::Component* currentChild = childrenQueue.front();
-        childrenQueue.pop_front();
-
-        const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& currentChildChildren = currentChild->getChildren();
-        for (const auto& currentChildChild : currentChildChildren) {
-            childrenQueue.push_back(currentChildChild.get());
+    refreshTraversalOrder();
+    if (hitTestGridValid) {
+        SFUI::Optional<SFUI::Vector2f> mousePosition = getMouseEventPosition(event);
+        if (mousePosition.has_value()) routeMouseEvent(event, mousePosition.value());
+        else if (event.is<SFUI::Event::KeyPressed>() || event.is<SFUI::Event::KeyReleased>()) routeKeyboardEvent(event, false);
+        else if (event.is<SFUI::Event::TextEntered>()) routeKeyboardEvent(event, true);
+        else {
+            for (SFUI::Component* subscriber : otherEventSubscribers) subscriber->handleEvent(event);
         }
-        currentChild->handleEvent(event);
+        return;
+    }
+
+    // Breadth-First Traversal of the UI for Component Event Handling //
+    mouseEngagedComponents.clear();
+    keyboardEngagedComponents.clear();
+    for (SFUI::Component* component : traversalOrder) {
+        if (isSubscribed(component->getEventSubscriptions(), event)) component->handleEvent(event);
+        refreshEngagement(component);
     }
 }
 
@@ -67,38 +101,112 @@ SFUI::Void SFUI::UIRoot::handleEvent(const SFUI::Event& event) {
 /**
  * @brief Updates all components contained in the UI.
  *
+ * Pre-updating and updating are fused into a single pass over the traversal order: the
+ * children of a component are pre-updated right before the component itself is updated,
+ * so any layout change they commit is seen by their parent. Components are only updated
+ * when one of their dirty flags is set, which also outdates the layers they are cached in,
+ * and damages the regions they were and are now drawn in. Updated components are moved in
+ * the hit-test grid, which is rebuilt from scratch when the tree or the render target size
+ * changes. A clean component whose parent was not indexed again keeps its clip, so the pass
+ * only pre-updates its children and moves on, and clean subtrees cost no more than that.
+ *
  * @param renderTargetSize The dimensions of the object to which the UI is rendering.
  */
 SFUI::Void SFUI::UIRoot::update(const SFUI::Vector2u renderTargetSize) {
     if (!rootComponent) return;
+    SFUI::Clock updateClock;
 
-    // Breadth-First Traversal Algorithm for UI Component Pre-Updating //
-    std::deque<SFUI::Component*> childrenQueue;
-    childrenQueue.push_back(rootComponent.get());
+    // The Damage Drawn by the Last Draw Is Kept Until Now, so It Can Still Be Read After the Draw //
+    if (damageDrawn) {
+        damageRects.clear();
+        damageDrawn = false;
+    }
 
-    while (!childrenQueue.empty()) {
-        SFUI::Component* currentChild = childrenQueue.front();
-        childrenQueue.pop_front();
-        const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& currentChildChildren = currentChild->getChildren();
-        for (const auto& currentChildChild : currentChildChildren) {
-            childrenQueue.push_back(currentChildChild.get());
-        }
-        currentChild->preUpdate();
+    // The Context Is Refreshed Every Update, so It Stays Valid if the UI Was Moved //
+    updateContext.meshRegistry = &meshRegistry;
+
+    // A Resized Render Target Invalidates Every Component //
+    SFUI::Bool renderTargetResized = (renderTargetSize != previousRenderTargetSize);
+    previousRenderTargetSize = renderTargetSize;
+
+    // Arcs Follow the Scale the UI Was Last Drawn At, and Arcs and Shadows Are Reduced by the Quality Level //
+    SFUI::QualityController::Level level = qualityController.getLevel();
+    SFUI::Float levelArcQuality = level >= SFUI::QualityController::Level::CoarseArcs ? COARSE_ARC_QUALITY : 1.0f;
+    SFUI::Float arcDetail = arcScale * arcQuality * levelArcQuality;
+    SFUI::Float shadowScale = 1.0f;
+    if (level >= SFUI::QualityController::Level::NoShadows) shadowScale = 0.0f;
+    else if (level >= SFUI::QualityController::Level::ReducedShadows) shadowScale = REDUCED_SHADOW_SCALE;
+
+    // A New Arc Level of Detail, Shadow Scale or Shadow Mode Rebuilds the Geometry of Every Component //
+    SFUI::Bool qualityChanged = (arcDetail != updateContext.arcDetail) || (shadowScale != updateContext.shadowScale) || (shadowRings != updateContext.shadowRings);
+    updateContext.arcDetail = arcDetail;
+    updateContext.shadowScale = shadowScale;
+    updateContext.shadowRings = shadowRings;
+
+    // Added Components or a Resized Render Target Require a Full Hit-Test Grid Rebuild //
+    refreshTraversalOrder();
+    if (renderTargetResized) hitTestGridValid = false;
+    SFUI::Bool rebuildHitTestGrid = !hitTestGridValid;
+    if (rebuildHitTestGrid) {
+        hitTestGrid.reset(renderTargetSize);
+        otherEventSubscribers.clear();
     }
+    SFUI::FloatRect renderTargetBounds({0.0f, 0.0f}, {static_cast<SFUI::Float>(renderTargetSize.x), static_cast<SFUI::Float>(renderTargetSize.y)});
 
-    // Breadth-First Traversal Algorithm for UI Component Updating //
-    childrenQueue.clear();
-    childrenQueue.push_back(rootComponent.get());
+    rootComponent->preUpdate();
+    if (renderTargetResized || qualityChanged) {
+        rootComponent->markDirty();
+        fullDamage = true;
+    }
 
-    while (!childrenQueue.empty()) {
-        SFUI::Component* currentChild = childrenQueue.front();
-        childrenQueue.pop_front();
-        const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& currentChildChildren = currentChild->getChildren();
-        for (const auto& currentChildChild : currentChildChildren) {
-            childrenQueue.push_back(currentChildChild.get());
+    // Breadth-First Traversal of the UI for Component Pre-Updating and Updating //
+    for (SFUI::Size traversalIndex = 0; traversalIndex < traversalOrder.size(); traversalIndex++) {
+        SFUI::Component* component = traversalOrder[traversalIndex];
+        for (const auto& child : component->getChildren()) {
+            child->preUpdate();
+            if (renderTargetResized || qualityChanged) child->markDirty();
         }
-        currentChild->update(renderTargetSize);
+
+        // A Clean Component Under a Parent That Kept Its Clip Has Nothing to Update or Index //
+        SFUI::Bool parentClipRefreshed = component->parent ? component->parent->childClipRefreshed : rebuildHitTestGrid;
+        if (!rebuildHitTestGrid && !parentClipRefreshed && !component->isDirty()) {
+            component->childClipRefreshed = false;
+            continue;
+        }
+
+        // A Changed Ancestor Clip Moves the Component's Hit Bounds and Those of Its Inner Components //
+        SFUI::FloatRect parentClip = component->parent ? hitTestGrid.getChildClip(component->parent) : renderTargetBounds;
+        SFUI::Optional<SFUI::FloatRect> previousClip = component->clipBounds;
+        if (component->clipBounds != parentClip) {
+            component->clipBounds = parentClip;
+            component->dirtyFlags.geometry = true;
+        }
+
+        SFUI::Bool componentDirty = component->isDirty();
+        if (componentDirty) {
+            if (previousClip.has_value()) addDamage(component->getDrawBounds(), previousClip.value());
+            invalidateLayers(component);
+            component->updateContext = &updateContext;
+            component->update(renderTargetSize);
+            addDamage(component->getDrawBounds(), parentClip);
+            occlusionDirty = true;
+        }
+        if (componentDirty || rebuildHitTestGrid) {
+            indexComponent(component, parentClip, traversalIndex);
+            refreshEngagement(component);
+        }
+        component->childClipRefreshed = componentDirty || rebuildHitTestGrid;
+        if (rebuildHitTestGrid && component->getEventSubscriptions().other) otherEventSubscribers.push_back(component);
     }
+    hitTestGridValid = true;
+
+    // Occlusion Only Changes With the Geometry and Clips of the Components //
+    if (occlusionCulling && (occlusionDirty || rebuildHitTestGrid)) {
+        occluders.clear();
+        findOccludedComponents(rootComponent.get());
+        occlusionDirty = false;
+    }
+    updateCost = updateClock.getElapsedTime();
 }
 
 
@@ -110,90 +218,818 @@ SFUI::Void SFUI::UIRoot::update(const SFUI::Vector2u renderTargetSize) {
  */
 SFUI::Void SFUI::UIRoot::draw(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
     if (!rootComponent) return;
+    SFUI::Clock drawClock;
 
-    // Depth-First Recursive Traversal Algorithm for UI Component Drawing //
-    glDisable(GL_SCISSOR_TEST);
-    drawRecursive(rootComponent, drawTarget, window);
+    // Arcs Are Tessellated for the Scale of the View, Taking Effect on the Next Update //
+    const SFUI::View& view = drawTarget.getView();
+    if (view.getSize().x > 0.0f && view.getSize().y > 0.0f) {
+        SFUI::IntRect viewport = drawTarget.getViewport(view);
+        SFUI::Float viewScale = std::max(viewport.size.x / view.getSize().x, viewport.size.y / view.getSize().y);
+        if (viewScale > 0.0f) arcScale = viewScale;
+    }
+
+    // Without a Usable Composite Texture the Whole Tree Is Redrawn //
+    if (!compositeTexture || !drawComposited(drawTarget)) {
+        drawRegions.assign(1, getVisibleArea(drawTarget));
+        drawTree(drawTarget, drawRegions, false);
+        compositeChanged = true;
+        fullDamage = static_cast<SFUI::Bool>(compositeTexture);
+    }
+    damageDrawn = true;
 
-    // Breadth-First Traversal Algorithm for UI Overlay Component Drawing //
-    drawOverlay(drawTarget, window);
+    // Breadth-First Traversal of the UI for Overlay Component Drawing //
+    SFUI::SFMLRenderBackend backend(drawTarget);
+    drawOverlay(backend);
+    if (adaptiveQuality) adaptQuality(updateCost + drawClock.getElapsedTime());
 }
 
 
 /**
- * @brief Recursive helper function to draw components and their children.
+ * @brief Draw the UI tree and its overlay pass to a render backend.
+ *
+ * Only the clips of the components themselves are applied, since the backend has no
+ * view to cull the tree against.
+ *
+ * @param backend The backend to draw to.
+ */
+SFUI::Void SFUI::UIRoot::draw(SFUI::RenderBackend& backend) {
+    if (!rootComponent) return;
+    SFUI::Clock drawClock;
+
+    renderBatch.begin(backend, renderBatching);
+    drawRecursive(renderBatch, rootComponent, false, true);
+    renderBatch.end();
+    drawOverlay(backend);
+    if (adaptiveQuality) adaptQuality(updateCost + drawClock.getElapsedTime());
+}
+
+
+/**
+ * @brief Enable or disable drawing the UI tree through a composite texture redrawn only when the UI changes.
+ *
+ * @param compositing Whether compositing is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setCompositing(SFUI::Bool compositing) {
+    compositingRequested = compositing;
+    applyQuality();
+}
+
+
+/**
+ * @brief Check if the last draw changed the drawn UI tree.
+ *
+ * @return True if the composite texture was redrawn, or compositing is disabled, false otherwise.
+ */
+SFUI::Bool SFUI::UIRoot::hasCompositeChanged() const {
+    return compositeChanged;
+}
+
+
+/**
+ * @brief Get the regions of the render target damaged by changed components since the draw before the last update.
+ *
+ * @return The disjoint damaged regions, or the whole render target if the tree structure or its size changed.
+ */
+SFUI::Vector<SFUI::FloatRect> SFUI::UIRoot::getDamageRects() const {
+    if (!fullDamage) return damageRects;
+    return {SFUI::FloatRect({0.0f, 0.0f}, {static_cast<SFUI::Float>(previousRenderTargetSize.x), static_cast<SFUI::Float>(previousRenderTargetSize.y)})};
+}
+
+
+/**
+ * @brief Get the composite texture holding the UI tree, with colors premultiplied by alpha.
+ *
+ * @return The composite texture, or nullptr if compositing is disabled or it was not drawn yet.
+ */
+const SFUI::Texture* SFUI::UIRoot::getCompositeTexture() const {
+    if (!compositeTexture || compositeTexture->getSize().x == 0) return nullptr;
+    return &compositeTexture->getTexture();
+}
+
+
+/**
+ * @brief Enable or disable merging the geometry of the UI tree into as few draw calls as possible.
+ *
+ * @param renderBatching Whether render batching is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setRenderBatching(SFUI::Bool renderBatching) {
+    this->renderBatching = renderBatching;
+}
+
+
+/**
+ * @brief Enable or disable keeping the geometry of the UI tree in GPU vertex buffers between frames.
+ *
+ * @param retainedGeometry Whether retained geometry is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setRetainedGeometry(SFUI::Bool retainedGeometry) {
+    renderBatch.setRetained(retainedGeometry);
+}
+
+
+/**
+ * @brief Enable or disable clipping the geometry and text of the UI on the CPU instead of with the scissor box.
+ *
+ * @param vertexClipping Whether vertex clipping is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setVertexClipping(SFUI::Bool vertexClipping) {
+    renderBatch.setVertexClipping(vertexClipping);
+    layerBatch.setVertexClipping(vertexClipping);
+    overlayBatch.setVertexClipping(vertexClipping);
+}
+
+
+/**
+ * @brief Enable or disable skipping components hidden beneath opaque components drawn after them.
+ *
+ * @param occlusionCulling Whether occlusion culling is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setOcclusionCulling(SFUI::Bool occlusionCulling) {
+    this->occlusionCulling = occlusionCulling;
+    occlusionDirty = true;
+    if (!occlusionCulling) {
+        for (SFUI::Component* component : traversalOrder) component->occluded = false;
+    }
+}
+
+
+/**
+ * @brief Set the quality of the rounded corners of the UI, trading arc fidelity for vertices.
+ *
+ * @param arcQuality The quality factor dividing the tolerated error.
+ */
+SFUI::Void SFUI::UIRoot::setArcQuality(SFUI::Float arcQuality) {
+    if (arcQuality <= 0.0f) return;
+    this->arcQuality = arcQuality;
+}
+
+
+/**
+ * @brief Enable or disable building shadows as a single gradient ring mesh instead of stacked layers.
+ *
+ * @param shadowRings Whether shadows are gradient rings.
+ */
+SFUI::Void SFUI::UIRoot::setShadowRings(SFUI::Bool shadowRings) {
+    this->shadowRings = shadowRings;
+}
+
+
+/**
+ * @brief Enable or disable adapting the rendering quality to the frame budget.
+ *
+ * @param adaptiveQuality Whether adaptive quality is enabled.
+ */
+SFUI::Void SFUI::UIRoot::setAdaptiveQuality(SFUI::Bool adaptiveQuality) {
+    if (adaptiveQuality == this->adaptiveQuality) return;
+    this->adaptiveQuality = adaptiveQuality;
+    qualityController.reset();
+    applyQuality();
+}
+
+
+/**
+ * @brief Set the budget of an update and draw for adaptive quality.
+ *
+ * @param frameBudget The largest frame cost allowed.
+ */
+SFUI::Void SFUI::UIRoot::setFrameBudget(SFUI::Time frameBudget) {
+    qualityController.setBudget(frameBudget);
+}
+
+
+/**
+ * @brief Set the callback triggered on each adaptive quality transition.
+ *
+ * @param onQualityChange The callback given the previous and new levels, the smoothed frame cost and the budget.
+ */
+SFUI::Void SFUI::UIRoot::setOnQualityChange(SFUI::QualityController::TransitionCallback onQualityChange) {
+    this->onQualityChange = std::move(onQualityChange);
+}
+
+
+/**
+ * @brief Get the current adaptive quality level.
+ *
+ * @return The quality level, always full when adaptive quality is disabled.
+ */
+SFUI::QualityController::Level SFUI::UIRoot::getQualityLevel() const {
+    return qualityController.getLevel();
+}
+
+
+/**
+ * @brief Get the drawing statistics of the UI tree in the last drawn frame.
+ *
+ * @return The draw call counts, culled component count and uploaded vertex count.
+ */
+SFUI::RenderBatch::FrameStatistics SFUI::UIRoot::getFrameStatistics() const {
+    return renderBatch.getFrameStatistics();
+}
+
+
+/**
+ * @brief Get the number of distinct meshes shared between the components of the UI.
+ *
+ * @return The number of shared meshes still used by a component.
+ */
+SFUI::Size SFUI::UIRoot::getSharedMeshCount() const {
+    return meshRegistry.getMeshCount();
+}
+
+
+/**
+ * @brief Find the components of a subtree hidden beneath opaque components drawn after them.
+ *
+ * The subtree is walked in reverse drawing order, so the occluders collected so far are
+ * exactly the components drawn after the current one. Both the tested draw bounds and the
+ * opaque rectangles are clipped by the ancestors, as they are when drawn.
+ *
+ * @param component The root of the subtree.
+ */
+SFUI::Void SFUI::UIRoot::findOccludedComponents(SFUI::Component* component) {
+    const auto& children = component->getChildren();
+    for (auto child = children.rbegin(); child != children.rend(); child++) {
+        findOccludedComponents(child->get());
+    }
+
+    component->occluded = false;
+    if (!component->clipBounds.has_value()) return;
+    SFUI::Optional<SFUI::FloatRect> visibleBounds = component->clipBounds->findIntersection(component->getDrawBounds());
+    if (!visibleBounds.has_value()) return;
+    for (const SFUI::FloatRect& occluder : occluders) {
+        if (visibleBounds->position.x >= occluder.position.x && visibleBounds->position.y >= occluder.position.y &&
+            visibleBounds->position.x + visibleBounds->size.x <= occluder.position.x + occluder.size.x &&
+            visibleBounds->position.y + visibleBounds->size.y <= occluder.position.y + occluder.size.y) {
+            component->occluded = true;
+            return;
+        }
+    }
+
+    // An Occluded Component's Opaque Rectangle Lies Within an Occluder Already //
+    SFUI::Optional<SFUI::FloatRect> opaqueBounds = component->getOpaqueBounds();
+    if (!opaqueBounds.has_value()) return;
+    SFUI::Optional<SFUI::FloatRect> visibleOpaqueBounds = component->clipBounds->findIntersection(opaqueBounds.value());
+    if (!visibleOpaqueBounds.has_value()) return;
+    if (occluders.size() < MAX_OCCLUDERS) {
+        occluders.push_back(visibleOpaqueBounds.value());
+        return;
+    }
+    auto smallestOccluder = std::min_element(occluders.begin(), occluders.end(), [](const SFUI::FloatRect& a, const SFUI::FloatRect& b) {
+        return a.size.x * a.size.y < b.size.x * b.size.y;
+    });
+    if (smallestOccluder->size.x * smallestOccluder->size.y < visibleOpaqueBounds->size.x * visibleOpaqueBounds->size.y) *smallestOccluder = visibleOpaqueBounds.value();
+}
+
+
+/**
+ * @brief Add the clipped draw bounds of a changed component to the damaged regions.
+ *
+ * The damage is snapped outwards to whole pixels, so the scissor boxes of the redraw cover
+ * every pixel it touches. Overlapping regions are merged so that no pixel is redrawn twice,
+ * and too many regions are merged into their bounding box, since each region costs a pass
+ * over the tree.
+ *
+ * @param drawBounds The draw bounds of the component.
+ * @param clip The clip of the component's ancestors when drawn with these bounds.
+ */
+SFUI::Void SFUI::UIRoot::addDamage(const SFUI::FloatRect& drawBounds, const SFUI::FloatRect& clip) {
+    if (fullDamage) return;
+    SFUI::Optional<SFUI::FloatRect> clippedBounds = clip.findIntersection(drawBounds);
+    if (!clippedBounds.has_value()) return;
+
+    SFUI::Float left = std::floor(clippedBounds->position.x);
+    SFUI::Float top = std::floor(clippedBounds->position.y);
+    SFUI::Float right = std::ceil(clippedBounds->position.x + clippedBounds->size.x);
+    SFUI::Float bottom = std::ceil(clippedBounds->position.y + clippedBounds->size.y);
+    SFUI::FloatRect damageRect({left, top}, {right - left, bottom - top});
+
+    // Merging Can Make the Region Overlap Ones It Did Not Before, so the Scan Restarts //
+    for (SFUI::Size damageIndex = 0; damageIndex < damageRects.size();) {
+        if (!damageRect.findIntersection(damageRects[damageIndex]).has_value()) {
+            damageIndex++;
+            continue;
+        }
+        damageRect = SFUI::Component::unionBounds(damageRect, damageRects[damageIndex]);
+        damageRects[damageIndex] = damageRects.back();
+        damageRects.pop_back();
+        damageIndex = 0;
+    }
+    damageRects.push_back(damageRect);
+    if (damageRects.size() <= MAX_DAMAGE_RECTS) return;
+
+    SFUI::FloatRect boundingBox = damageRects.front();
+    for (const SFUI::FloatRect& damagedRegion : damageRects) {
+        boundingBox = SFUI::Component::unionBounds(boundingBox, damagedRegion);
+    }
+    damageRects.assign(1, boundingBox);
+}
+
+
+/**
+ * @brief Draw regions of the UI tree, without the overlay pass, to a render target.
+ *
+ * Each region is drawn in its own pass over the tree, clipped to the region, so the
+ * components lying outside of it are culled.
  *
- * @param component The current component to draw.
  * @param drawTarget The render target to draw on.
- * @param window The render window associated with the render target.
+ * @param regions The regions of the render target to draw.
+ * @param clearRegions Whether the regions are cleared to transparency before drawing.
  */
-SFUI::Void SFUI::UIRoot::drawRecursive(const SFUI::UniquePointer<SFUI::Component>& component, SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
-    component->draw(drawTarget, window);
-
-    // Save Clipping State for Containing Children within its Bounds and Padding //
-    GLint parentClipping[4];
-    GLboolean scissorWasEnabled = glIsEnabled(GL_SCISSOR_TEST);
-    if (scissorWasEnabled) glGetIntegerv(GL_SCISSOR_BOX, parentClipping);
-    SFUI::Vector2i componentPosition = component->getPosition();
-    SFUI::Vector2f componentSize = component->getSize();
-    SFUI::Vector4f componentPadding = component->getPadding();
-    GLint newClipping[4] = {
-        static_cast<GLint>(componentPosition.x + componentPadding.x),
-        static_cast<GLint>(drawTarget.getSize().y - (componentPosition.y + componentPadding.z) - (componentSize.y - componentPadding.z - componentPadding.w)),
-        static_cast<GLint>(componentSize.x - (componentPadding.x + componentPadding.y)),
-        static_cast<GLint>(componentSize.y - (componentPadding.z + componentPadding.w))
-    };
-    if (scissorWasEnabled) {
-        GLint newRight = newClipping[0] + newClipping[2];
-        GLint newBottom = newClipping[1] + newClipping[3];
-        GLint parentRight = parentClipping[0] + parentClipping[2];
-        GLint parentBottom = parentClipping[1] + parentClipping[3];
-        newClipping[0] = std::max(newClipping[0], parentClipping[0]);
-        newClipping[1] = std::max(newClipping[1], parentClipping[1]);
-        newClipping[2] = std::min(newRight, parentRight) - newClipping[0];
-        newClipping[3] = std::min(newBottom, parentBottom) - newClipping[1];
-        newClipping[2] = std::max(0, newClipping[2]);
-        newClipping[3] = std::max(0, newClipping[3]);
+SFUI::Void SFUI::UIRoot::drawTree(SFUI::RenderTarget& drawTarget, const SFUI::Vector<SFUI::FloatRect>& regions, SFUI::Bool clearRegions) {
+    layerCache.beginFrame();
+    SFUI::SFMLRenderBackend backend(drawTarget);
+    renderBatch.begin(backend, renderBatching);
+
+    // The Clear Shapes Are Drawn When the Batch Is Replayed, so They Must Outlive It, and Are Kept for the Next Frames //
+    if (clearRegions && clearShapes.size() < regions.size()) clearShapes.resize(regions.size());
+    for (SFUI::Size regionIndex = 0; regionIndex < regions.size(); regionIndex++) {
+        const SFUI::FloatRect& region = regions[regionIndex];
+        if (clearRegions) {
+            SFUI::RectangleShape& clearShape = clearShapes[regionIndex];
+            clearShape.setSize(region.size);
+            clearShape.setPosition(region.position);
+            clearShape.setFillColor(SFUI::Color::Transparent);
+            renderBatch.draw(clearShape, SFUI::RenderStates(DAMAGE_CLEAR_BLEND_MODE));
+        }
+
+        // Depth-First Recursive Traversal Algorithm for UI Component Drawing //
+        renderBatch.pushClip(region);
+        drawRecursive(renderBatch, rootComponent, true, true);
+        renderBatch.popClip();
+    }
+    renderBatch.end();
+    layerCache.endFrame();
+}
+
+
+/**
+ * @brief Draw the UI tree through the composite texture, redrawing its damaged regions first.
+ *
+ * The composite texture follows the size of the render target and keeps its contents
+ * between frames, so only the regions damaged since the last draw are cleared and redrawn.
+ * It is fully redrawn after the tree structure or the render target size changed. Without
+ * damage, drawing the UI tree only costs the single quad of the composite texture.
+ *
+ * @param drawTarget The render target to draw on.
+ *
+ * @return True if drawn, false if the composite texture cannot be used.
+ */
+SFUI::Bool SFUI::UIRoot::drawComposited(SFUI::RenderTarget& drawTarget) {
+    compositeChanged = false;
+    SFUI::Vector2u targetSize = {drawTarget.getSize().x, drawTarget.getSize().y};
+    SFUI::Vector2u compositeSize = {compositeTexture->getSize().x, compositeTexture->getSize().y};
+    if (compositeSize != targetSize) {
+        fullDamage = true;
+        if (!compositeTexture->resize(targetSize)) return false;
+    }
+
+    if (fullDamage || !damageRects.empty()) {
+        if (!compositeTexture->setActive(true)) return false;
+        SFUI::Bool clearRegions = !fullDamage;
+        if (fullDamage) {
+            compositeTexture->clear(SFUI::Color::Transparent);
+            damageRects.assign(1, SFUI::FloatRect({0.0f, 0.0f}, {static_cast<SFUI::Float>(targetSize.x), static_cast<SFUI::Float>(targetSize.y)}));
+        }
+        drawTree(*compositeTexture, damageRects, clearRegions);
+        compositeTexture->display();
+        static_cast<SFUI::Void>(drawTarget.setActive(true));
+        fullDamage = false;
+        compositeChanged = true;
+    }
+
+    SFUI::Sprite compositeSprite(compositeTexture->getTexture());
+    drawTarget.draw(compositeSprite, SFUI::RenderStates(LAYER_BLEND_MODE));
+    return true;
+}
+
+
+/**
+ * @brief Get the area of the UI shown by the current view of a render target.
+ *
+ * The corners of the view's viewport are mapped back through the view, so the area is in the
+ * same coordinates as the component bounds it is compared against, whatever the view's size,
+ * position or rotation.
+ *
+ * @param drawTarget The render target to draw on.
+ *
+ * @return The visible area, in the coordinates of the current view.
+ */
+SFUI::FloatRect SFUI::UIRoot::getVisibleArea(const SFUI::RenderTarget& drawTarget) {
+    SFUI::IntRect viewport = drawTarget.getViewport(drawTarget.getView());
+    SFUI::Array<sf::Vector2f, 4> corners = {
+        drawTarget.mapPixelToCoords(viewport.position),
+        drawTarget.mapPixelToCoords({viewport.position.x + viewport.size.x, viewport.position.y}),
+        drawTarget.mapPixelToCoords({viewport.position.x, viewport.position.y + viewport.size.y}),
+        drawTarget.mapPixelToCoords(viewport.position + viewport.size)
     };
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(newClipping[0], newClipping[1], newClipping[2], newClipping[3]);
+
+    sf::Vector2f minimum = corners[0];
+    sf::Vector2f maximum = corners[0];
+    for (const sf::Vector2f& corner : corners) {
+        minimum = {std::min(minimum.x, corner.x), std::min(minimum.y, corner.y)};
+        maximum = {std::max(maximum.x, corner.x), std::max(maximum.y, corner.y)};
+    }
+    return SFUI::FloatRect(minimum, maximum - minimum);
+}
+
+
+/**
+ * @brief Set the memory budget of the texture layers of components cached as layers.
+ *
+ * @param budgetBytes The budget in bytes.
+ */
+SFUI::Void SFUI::UIRoot::setLayerBudget(SFUI::Size budgetBytes) {
+    layerCache.setBudget(budgetBytes);
+}
+
+
+/**
+ * @brief Get the memory statistics of the texture layers of components cached as layers.
+ *
+ * @return The layer count and memory, budget, and the layers redrawn and evicted in the last drawn frame.
+ */
+SFUI::LayerCache::Statistics SFUI::UIRoot::getLayerStatistics() const {
+    return layerCache.getStatistics();
+}
+
+
+/**
+ * @brief Measure the cost of a frame for adaptive quality, applying and reporting any quality transition.
+ *
+ * @param frameCost The CPU cost of the last update and draw.
+ */
+SFUI::Void SFUI::UIRoot::adaptQuality(SFUI::Time frameCost) {
+    SFUI::Optional<SFUI::QualityController::Transition> transition = qualityController.addFrame(frameCost);
+    if (!transition.has_value()) return;
+    applyQuality();
+    if (onQualityChange) onQualityChange(transition.value());
+}
+
+
+/**
+ * @brief Apply the compositing setting of the current quality level.
+ *
+ * Compositing only redraws the damaged parts of the tree, so it is the first reduction and costs
+ * no fidelity. The coarser arcs and the narrowed or dropped shadows of the later levels are applied
+ * by the next update, which rebuilds the geometry of every component, which then stays cheaper for
+ * every frame that redraws it.
+ */
+SFUI::Void SFUI::UIRoot::applyQuality() {
+    SFUI::QualityController::Level level = qualityController.getLevel();
+
+    SFUI::Bool compositing = compositingRequested || level >= SFUI::QualityController::Level::Composited;
+    if (compositing != static_cast<SFUI::Bool>(compositeTexture)) {
+        if (compositing) compositeTexture = std::make_unique<SFUI::RenderTexture>();
+        else compositeTexture.reset();
+        fullDamage = true;
+    }
+}
+
+
+/**
+ * @brief Flag the layers containing a changed component as outdated.
+ *
+ * Every ancestor cached as a layer is outdated, since the layer of an ancestor holds the
+ * pixels of its whole subtree. A component that stopped being cached as a layer frees it.
+ *
+ * @param component The component about to be updated.
+ */
+SFUI::Void SFUI::UIRoot::invalidateLayers(const SFUI::Component* component) {
+    if (layerCache.isEmpty()) return;
+    if (!component->isCachedAsLayer()) layerCache.release(component);
+    for (const SFUI::Component* ancestor = component; ancestor; ancestor = ancestor->parent) {
+        layerCache.invalidate(ancestor);
+    }
+}
+
+
+/**
+ * @brief Recursive helper function to draw components and their children.
+ *
+ * Children are clipped to their parent's bounds and padding. The clip only splits the
+ * batched geometry where it actually changes between two consecutive draws. A component
+ * whose drawn bounds miss the current clip is culled along with its subtree, since its
+ * children are clipped to a box inside those bounds. A component cached as a layer is
+ * drawn with its subtree as a single textured quad. An occluded component is skipped,
+ * but not its children.
+ *
+ * @param renderBatch The batch to draw through.
+ * @param component The current component to draw.
+ * @param layered Whether components cached as layers are drawn through their layer.
+ * @param skipOccluded Whether occluded components are skipped, which they are not inside a layer.
+ */
+SFUI::Void SFUI::UIRoot::drawRecursive(SFUI::RenderBatch& renderBatch, const SFUI::UniquePointer<SFUI::Component>& component, SFUI::Bool layered, SFUI::Bool skipOccluded) {
+    SFUI::Optional<SFUI::FloatRect> clip = renderBatch.getClip();
+    if (clip.has_value() && !clip->findIntersection(component->getDrawBounds()).has_value()) {
+        renderBatch.countCulled(countSubtree(component.get()));
+        return;
+    }
+    if (layered && component->isCachedAsLayer() && drawLayer(component)) return;
+
+    // Layers Ignore Occlusion, Since Their Contents Are Not Redrawn When It Changes //
+    if (skipOccluded && component->occluded) renderBatch.countOccluded();
+    else component->drawBatched(renderBatch);
 
     // Recursive Draw Call //
+    renderBatch.pushClip(component->getContentBox());
     for (const auto& child : component->getChildren()) {
-        drawRecursive(child, drawTarget, window);
+        drawRecursive(renderBatch, child, layered, skipOccluded);
     }
+    renderBatch.popClip();
+}
+
+
+/**
+ * @brief Draw a component and its children through their cached layer, redrawing it first if outdated.
+ *
+ * The layer is redrawn through its own batch, with the view of its render texture placed on
+ * the layer bounds so components keep drawing at their render target coordinates. Its whole
+ * subtree is drawn regardless of the current clip, which only applies to the textured quad,
+ * so the contents of the layer do not depend on its ancestors. Layers nested in a layer are
+ * drawn directly into it. The layer is drawn before the tree's batch is replayed, which
+ * reactivates the render target first.
+ *
+ * @param component The component cached as a layer.
+ *
+ * @return True if drawn through the layer, false if the component must be drawn directly.
+ */
+SFUI::Bool SFUI::UIRoot::drawLayer(const SFUI::UniquePointer<SFUI::Component>& component) {
+    SFUI::LayerCache::Layer* layer = layerCache.acquire(component.get(), component->getDrawBounds());
+    if (!layer) return false;
+
+    if (!layer->valid) {
+        if (!layer->renderTexture.setActive(true)) {
+            layerCache.release(component.get());
+            return false;
+        }
+        layer->renderTexture.setView(SFUI::View(layer->bounds));
+        layer->renderTexture.clear(SFUI::Color::Transparent);
+        SFUI::SFMLRenderBackend layerBackend(layer->renderTexture);
+        layerBatch.begin(layerBackend, renderBatching);
+        layerBatch.pushClip(layer->bounds);
+        drawRecursive(layerBatch, component, false, false);
+        layerBatch.popClip();
+        layerBatch.end();
+        layer->renderTexture.display();
+        layerCache.validate(*layer);
+    }
+
+    SFUI::Sprite layerSprite(layer->renderTexture.getTexture());
+    layerSprite.setPosition(layer->bounds.position);
+    renderBatch.draw(layerSprite, SFUI::RenderStates(LAYER_BLEND_MODE));
+    return true;
+}
+
 
-    // Restore Previous Clipping //
-    if (scissorWasEnabled) {
-        glScissor(parentClipping[0], parentClipping[1], parentClipping[2], parentClipping[3]);
-    }   else {
-        glDisable(GL_SCISSOR_TEST);
+/**
+ * @brief Count the components of a subtree.
+ *
+ * @param component The root of the subtree.
+ *
+ * @return The number of components in the subtree, including its root.
+ */
+SFUI::Size SFUI::UIRoot::countSubtree(const SFUI::Component* component) {
+    SFUI::Size componentCount = 1;
+    for (const auto& child : component->getChildren()) {
+        componentCount += countSubtree(child.get());
     }
+    return componentCount;
 }
 
 
 /**
- * @brief Draw the overlay components of the UI to the render target.
+ * @brief Draw the overlay components of the UI to a render backend.
  *
- * @param drawTarget Target to draw on.
- * @param window Window reference.
+ * @param backend The backend to draw to.
  */
-SFUI::Void SFUI::UIRoot::drawOverlay(SFUI::RenderTarget& drawTarget, SFUI::RenderWindow& window) {
+SFUI::Void SFUI::UIRoot::drawOverlay(SFUI::RenderBackend& backend) {
     if (!rootComponent) return;
 
-    // Breadth-First Traversal Algorithm for UI Overlay Component Drawing //
-    std::deque<SFUI::Component*> childrenQueue;
-    childrenQueue.push_back(rootComponent.get());
+    // Breadth-First Traversal of the UI for Overlay Component Drawing //
+    refreshTraversalOrder();
+    overlayBatch.begin(backend, renderBatching);
+    for (SFUI::Component* component : traversalOrder) {
+        component->drawOverlayBatched(overlayBatch);
+    }
+    overlayBatch.end();
+}
+
+
 
-    while (!childrenQueue.empty()) {
-        SFUI::Component* currentChild = childrenQueue.front();
-        childrenQueue.pop_front();
+/**
+ * @brief Flatten the UI tree into its breadth-first traversal order if its structure changed.
+ *
+ * The traversal order doubles as the breadth-first queue, so rebuilding it only allocates
+ * when the tree outgrew the capacity of a previous build. A rebuild also invalidates the
+ * hit-test grid, since the added components are not indexed yet.
+ */
+SFUI::Void SFUI::UIRoot::refreshTraversalOrder() {
+    if (!rootComponent->treeStructureDirty) return;
+    rootComponent->treeStructureDirty = false;
+    hitTestGridValid = false;
 
-        const SFUI::Vector<SFUI::UniquePointer<SFUI::Component>>& currentChildChildren = currentChild->getChildren();
-        for (const auto& currentChildChild : currentChildChildren) {
-            childrenQueue.push_back(currentChildChild.get());
+    traversalOrder.clear();
+    traversalOrder.push_back(rootComponent.get());
+    for (SFUI::Size traversalIndex = 0; traversalIndex < traversalOrder.size(); traversalIndex++) {
+        for (const auto& child : traversalOrder[traversalIndex]->getChildren()) {
+            traversalOrder.push_back(child.get());
         }
+    }
+
+    // Removed Components May Still Be Referenced by the Event Routing Lists //
+    mouseEngagedComponents.clear();
+    keyboardEngagedComponents.clear();
+    otherEventSubscribers.clear();
 
-        currentChild->drawOverlay(drawTarget, window);
+    rebuildComponentIndex();
+    layerCache.prune(traversalOrder);
+    fullDamage = true;
+}
+
+
+/**
+ * @brief Rebuild the component index from the traversal order.
+ *
+ * The first component of the breadth-first order wins when several share an ID, matching
+ * the previous linear search. Slots are never erased: a slot whose component changed or
+ * left the tree has its generation bumped so that outstanding handles stop resolving.
+ */
+SFUI::Void SFUI::UIRoot::rebuildComponentIndex() {
+    componentIndexBuild++;
+    for (SFUI::Component* component : traversalOrder) {
+        auto [slotIterator, inserted] = componentSlotIndices.try_emplace(component->componentID, componentSlots.size());
+        if (inserted) componentSlots.emplace_back();
+        SFUI::UIRoot::ComponentSlot& componentSlot = componentSlots[slotIterator->second];
+        if (componentSlot.indexedBuild == componentIndexBuild) continue;
+        componentSlot.indexedBuild = componentIndexBuild;
+        if (componentSlot.component == component) continue;
+        componentSlot.component = component;
+        componentSlot.type = &typeid(*component);
+        componentSlot.generation++;
     }
+
+    // Release the Slots of Components That Left the Tree //
+    for (SFUI::UIRoot::ComponentSlot& componentSlot : componentSlots) {
+        if (componentSlot.indexedBuild == componentIndexBuild || !componentSlot.component) continue;
+        componentSlot.component = nullptr;
+        componentSlot.type = nullptr;
+        componentSlot.generation++;
+    }
+}
+
+
+/**
+ * @brief Find the component index slot of a component ID.
+ *
+ * A component renamed since the last index build is caught by comparing its current ID,
+ * which forces a rebuild of the index.
+ *
+ * @param componentID Component ID to look up.
+ *
+ * @return Pointer to the slot, or nullptr if no component of the tree has the ID.
+ */
+const SFUI::UIRoot::ComponentSlot* SFUI::UIRoot::findComponentSlot(const SFUI::String& componentID) {
+    if (!rootComponent) return nullptr;
+    refreshTraversalOrder();
+
+    auto slotIterator = componentSlotIndices.find(componentID);
+    if (slotIterator == componentSlotIndices.end()) return nullptr;
+    const SFUI::UIRoot::ComponentSlot* componentSlot = &componentSlots[slotIterator->second];
+    if (!componentSlot->component) return nullptr;
+    if (componentSlot->component->componentID != componentID) {
+        rebuildComponentIndex();
+        if (!componentSlot->component || componentSlot->component->componentID != componentID) return nullptr;
+    }
+    return componentSlot;
+}
+
+
+/**
+ * @brief Get the cursor position carried by a mouse event.
+ *
+ * @param event The event to inspect.
+ *
+ * @return The cursor position, or an empty optional if the event is not a positioned mouse event.
+ */
+SFUI::Optional<SFUI::Vector2f> SFUI::UIRoot::getMouseEventPosition(const SFUI::Event& event) {
+    if (const SFUI::Event::MouseMoved* mouseMovedEvent = event.getIf<SFUI::Event::MouseMoved>())
+        return SFUI::Vector2f(mouseMovedEvent->position.x, mouseMovedEvent->position.y);
+    if (const SFUI::Event::MouseButtonPressed* mousePressedEvent = event.getIf<SFUI::Event::MouseButtonPressed>())
+        return SFUI::Vector2f(mousePressedEvent->position.x, mousePressedEvent->position.y);
+    if (const SFUI::Event::MouseButtonReleased* mouseReleasedEvent = event.getIf<SFUI::Event::MouseButtonReleased>())
+        return SFUI::Vector2f(mouseReleasedEvent->position.x, mouseReleasedEvent->position.y);
+    if (const SFUI::Event::MouseWheelScrolled* mouseWheelScrolledEvent = event.getIf<SFUI::Event::MouseWheelScrolled>())
+        return SFUI::Vector2f(mouseWheelScrolledEvent->position.x, mouseWheelScrolledEvent->position.y);
+    return std::nullopt;
+}
+
+
+/**
+ * @brief Route a mouse event to the components under the cursor and the engaged components.
+ *
+ * Targets receive the event in the same breadth-first order as a full propagation would use.
+ * Afterwards, the mouse engaged components are recollected from the targets.
+ *
+ * @param event The event to process.
+ * @param mousePosition The cursor position carried by the event.
+ */
+SFUI::Void SFUI::UIRoot::routeMouseEvent(const SFUI::Event& event, const SFUI::Vector2f& mousePosition) {
+    eventTargets.clear();
+    hitTestGrid.query(mousePosition, eventTargets);
+    eventTargets.insert(eventTargets.end(), mouseEngagedComponents.begin(), mouseEngagedComponents.end());
+    std::sort(eventTargets.begin(), eventTargets.end(), [this](const SFUI::Component* a, const SFUI::Component* b) {
+        return hitTestGrid.getOrder(a) < hitTestGrid.getOrder(b);
+    });
+    eventTargets.erase(std::unique(eventTargets.begin(), eventTargets.end()), eventTargets.end());
+
+    mouseEngagedComponents.clear();
+    for (SFUI::Component* target : eventTargets) {
+        target->handleEvent(event);
+        refreshEngagement(target);
+    }
+}
+
+
+/**
+ * @brief Route a keyboard or text event to the engaged components subscribed to it.
+ *
+ * @param event The event to process.
+ * @param isTextEvent Whether the event is a text event rather than a keyboard event.
+ */
+SFUI::Void SFUI::UIRoot::routeKeyboardEvent(const SFUI::Event& event, SFUI::Bool isTextEvent) {
+    eventTargets.clear();
+    for (SFUI::Component* component : keyboardEngagedComponents) {
+        SFUI::Component::EventSubscriptions subscriptions = component->getEventSubscriptions();
+        if (isTextEvent ? subscriptions.text : subscriptions.keyboard) eventTargets.push_back(component);
+    }
+    std::sort(eventTargets.begin(), eventTargets.end(), [this](const SFUI::Component* a, const SFUI::Component* b) {
+        return hitTestGrid.getOrder(a) < hitTestGrid.getOrder(b);
+    });
+
+    for (SFUI::Component* target : eventTargets) {
+        target->handleEvent(event);
+        refreshEngagement(target);
+    }
+}
+
+
+/**
+ * @brief Check if a component is subscribed to the type of an event.
+ *
+ * @param subscriptions The event subscriptions of the component.
+ * @param event The event to check.
+ *
+ * @return True if the component consumes the event, false otherwise.
+ */
+SFUI::Bool SFUI::UIRoot::isSubscribed(const SFUI::Component::EventSubscriptions& subscriptions, const SFUI::Event& event) {
+    if (getMouseEventPosition(event).has_value()) return subscriptions.mouse;
+    if (event.is<SFUI::Event::KeyPressed>() || event.is<SFUI::Event::KeyReleased>()) return subscriptions.keyboard;
+    if (event.is<SFUI::Event::TextEntered>()) return subscriptions.text;
+    return subscriptions.other;
+}
+
+
+/**
+ * @brief Add or remove a component from the engaged component lists according to its current state.
+ *
+ * @param component The component to check.
+ */
+SFUI::Void SFUI::UIRoot::refreshEngagement(SFUI::Component* component) {
+    SFUI::Component::EventSubscriptions subscriptions = component->getEventSubscriptions();
+    setEngaged(mouseEngagedComponents, component, subscriptions.mouse && component->isMouseEngaged());
+    setEngaged(keyboardEngagedComponents, component, (subscriptions.keyboard || subscriptions.text) && component->isKeyboardEngaged());
+}
+
+
+/**
+ * @brief Add or remove a component from an engaged component list.
+ *
+ * @param engagedComponents The engaged component list to modify.
+ * @param component The component to add or remove.
+ * @param engaged Whether the component is engaged.
+ */
+SFUI::Void SFUI::UIRoot::setEngaged(SFUI::Vector<SFUI::Component*>& engagedComponents, SFUI::Component* component, SFUI::Bool engaged) {
+    auto engagedIterator = std::find(engagedComponents.begin(), engagedComponents.end(), component);
+    SFUI::Bool listed = (engagedIterator != engagedComponents.end());
+    if (engaged && !listed) engagedComponents.push_back(component);
+    else if (!engaged && listed) engagedComponents.erase(engagedIterator);
+}
+
+
+/**
+ * @brief Index a component in the hit-test grid using its parent's clip.
+ *
+ * The component's hit bounds are clipped by its parent's clip, and its children are clipped
+ * to its padded content box, matching the scissor boxes set in drawRecursive(). Components
+ * not subscribed to mouse events are indexed without hit bounds, so they are never hit.
+ *
+ * @param component The component to index.
+ * @param parentClip The clip rectangle applied to the component by its ancestors.
+ * @param order The traversal order of the component.
+ */
+SFUI::Void SFUI::UIRoot::indexComponent(SFUI::Component* component, const SFUI::FloatRect& parentClip, SFUI::Size order) {
+    SFUI::FloatRect childClip = parentClip.findIntersection(component->getContentBox()).value_or(SFUI::FloatRect({parentClip.position.x, parentClip.position.y}, {0.0f, 0.0f}));
+    SFUI::Optional<SFUI::FloatRect> hitBounds;
+    if (component->getEventSubscriptions().mouse) hitBounds = parentClip.findIntersection(component->getHitBounds());
+    hitTestGrid.insert(component, hitBounds, childClip, order);
 }
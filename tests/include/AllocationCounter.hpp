@@ -0,0 +1,75 @@
+/**
+ * @file AllocationCounter.hpp
+ * @brief Replaces the global allocation functions to count heap allocations.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file defines the replacement global operator new and operator
+ * delete, which count every heap allocation of the program, including the
+ * ones made inside the library. Since it defines them, it must be included
+ * by exactly one source file of a test program.
+ */
+
+
+#pragma once
+#include "TestUtilities.hpp"
+#include <cstdlib>
+#include <new>
+
+
+namespace SFUITest {
+
+    /**
+     * @brief Number of heap allocations made by the program since it started.
+     */
+    inline SFUI::Size allocationCount = 0;
+
+    /**
+     * @brief Allocate memory, counting the allocation.
+     *
+     * @param size Number of bytes to allocate.
+     *
+     * @return Allocated memory, or nullptr if out of memory.
+     */
+    inline SFUI::Void* countedAllocate(SFUI::Size size) {
+        allocationCount++;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+
+// Counted Replacements of the Global Allocation Functions //
+SFUI::Void* operator new(SFUI::Size size) {
+    if (SFUI::Void* memory = SFUITest::countedAllocate(size)) return memory;
+    throw std::bad_alloc();
+}
+
+SFUI::Void* operator new[](SFUI::Size size) {
+    if (SFUI::Void* memory = SFUITest::countedAllocate(size)) return memory;
+    throw std::bad_alloc();
+}
+
+SFUI::Void* operator new(SFUI::Size size, const std::nothrow_t&) noexcept {
+    return SFUITest::countedAllocate(size);
+}
+
+SFUI::Void* operator new[](SFUI::Size size, const std::nothrow_t&) noexcept {
+    return SFUITest::countedAllocate(size);
+}
+
+SFUI::Void operator delete(SFUI::Void* memory) noexcept {
+    std::free(memory);
+}
+
+SFUI::Void operator delete[](SFUI::Void* memory) noexcept {
+    std::free(memory);
+}
+
+SFUI::Void operator delete(SFUI::Void* memory, SFUI::Size) noexcept {
+    std::free(memory);
+}
+
+SFUI::Void operator delete[](SFUI::Void* memory, SFUI::Size) noexcept {
+    std::free(memory);
+}
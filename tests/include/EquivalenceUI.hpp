@@ -0,0 +1,203 @@
+/**
+ * @file EquivalenceUI.hpp
+ * @brief Defines the UI and frame changes shared by the render equivalence tests.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * The render equivalence tests draw two copies of the same UI, one with a
+ * drawing mode enabled and one drawn plainly, apply the same change to both
+ * before every frame, and compare the drawn frames. The UI has a header, a
+ * sidebar of buttons above a covered panel, and a scroll container of
+ * items. The frames recolor, hover, scroll and uncover components, and one
+ * frame changes nothing.
+ *
+ * The layout only uses whole pixel sizes, so layer and composite textures
+ * line up with the pixels of the render target.
+ */
+
+
+#pragma once
+#include "TestUtilities.hpp"
+
+
+namespace SFUITest {
+
+    /**
+     * @brief Size of the render target the equivalence UI is drawn on.
+     */
+    inline const SFUI::Vector2u EQUIVALENCE_TARGET_SIZE = {320, 240};
+
+    /**
+     * @brief Number of frames drawn by the equivalence tests, each after its change.
+     */
+    inline constexpr SFUI::Size EQUIVALENCE_FRAME_COUNT = 8;
+
+    /**
+     * @brief Frame of the equivalence tests that changes nothing.
+     */
+    inline constexpr SFUI::Size UNCHANGED_FRAME = 5;
+
+    /**
+     * @brief Frame of the equivalence tests that turns the child covering the covered panel translucent.
+     */
+    inline constexpr SFUI::Size UNCOVERING_FRAME = 6;
+
+    /**
+     * @brief Build the UI shared by the render equivalence tests.
+     *
+     * @param ui UI to build the tree of.
+     * @param font Font of the header label.
+     * @param cacheAsLayer Whether the header and sidebar are cached as layers.
+     */
+    inline SFUI::Void buildEquivalenceUI(SFUI::UIRoot& ui, SFUI::SharedPointer<SFUI::Font> font, SFUI::Bool cacheAsLayer = false) {
+        SFUI::PropSet::Container rootProps;
+        rootProps.layout.alignDirection = "vertical";
+        rootProps.layout.alignPrimary = "start";
+        rootProps.layout.width = "100%";
+        rootProps.layout.height = "100%";
+        rootProps.layout.padding = 8.0f;
+        rootProps.style.fillColor = SFUI::Color(32, 32, 32);
+
+        SFUI::PropSet::Container headerProps;
+        headerProps.layout.width = "100%";
+        headerProps.layout.height = 40.0f;
+        headerProps.style.cornerRadius = 6.0f;
+        headerProps.style.fillColor = SFUI::Color(70, 70, 70);
+        headerProps.style.cacheAsLayer = cacheAsLayer;
+
+        SFUI::PropSet::Label headerLabelProps;
+        headerLabelProps.layout.width = "100%";
+        headerLabelProps.layout.height = "100%";
+        headerLabelProps.style.text = "Header";
+        headerLabelProps.style.font = font;
+        headerLabelProps.style.textSize = 20.0f;
+        headerLabelProps.style.textAlignHorizontal = "center";
+        headerLabelProps.style.textColor = SFUI::Color(255, 255, 255);
+
+        SFUI::PropSet::Container bodyProps;
+        bodyProps.layout.alignDirection = "horizontal";
+        bodyProps.layout.alignPrimary = "start";
+        bodyProps.layout.width = "100%";
+        bodyProps.layout.height = 184.0f;
+
+        SFUI::PropSet::Container sidebarProps;
+        sidebarProps.layout.alignDirection = "vertical";
+        sidebarProps.layout.alignPrimary = "start";
+        sidebarProps.layout.width = 100.0f;
+        sidebarProps.layout.height = "100%";
+        sidebarProps.layout.padding = 6.0f;
+        sidebarProps.style.fillColor = SFUI::Color(50, 50, 60);
+        sidebarProps.style.cacheAsLayer = cacheAsLayer;
+
+        SFUI::PropSet::Button buttonProps;
+        buttonProps.layout.width = "100%";
+        buttonProps.layout.height = 40.0f;
+        buttonProps.style.cornerRadius = 5.0f;
+        buttonProps.style.borderWidth = 2.0f;
+        buttonProps.style.fillColor = SFUI::Color(90, 90, 90);
+        buttonProps.style.hoveredFillColor = SFUI::Color(120, 120, 160);
+        buttonProps.style.borderColor = SFUI::Color(200, 200, 200);
+
+        SFUI::PropSet::Container coverProps;
+        coverProps.layout.width = "100%";
+        coverProps.layout.height = 50.0f;
+        coverProps.style.fillColor = SFUI::Color(90, 40, 40);
+
+        SFUI::PropSet::Container coverChildProps;
+        coverChildProps.layout.width = "100%";
+        coverChildProps.layout.height = "100%";
+        coverChildProps.style.fillColor = SFUI::Color(40, 90, 40);
+
+        SFUI::PropSet::ScrollContainer listProps;
+        listProps.layout.alignDirection = "vertical";
+        listProps.layout.alignPrimary = "start";
+        listProps.layout.width = 204.0f;
+        listProps.layout.height = "100%";
+        listProps.layout.padding = 6.0f;
+        listProps.style.fillColor = SFUI::Color(40, 40, 40);
+
+        SFUI::PropSet::Container itemProps;
+        itemProps.layout.width = "100%";
+        itemProps.layout.height = 50.0f;
+        itemProps.style.cornerRadius = 8.0f;
+        itemProps.style.borderWidth = 2.0f;
+        itemProps.style.borderColor = SFUI::Color(230, 230, 230);
+
+        SFUI::UniquePointer<SFUI::ScrollContainer> list = std::make_unique<SFUI::ScrollContainer>("list", listProps);
+        for (SFUI::Size i = 0; i < 6; i++) {
+            itemProps.style.fillColor = SFUI::Color(static_cast<SFUI::UnsignedInt8>(60 + 30 * i), 100, static_cast<SFUI::UnsignedInt8>(210 - 30 * i));
+            list->addChild(std::make_unique<SFUI::Container>("item" + std::to_string(i), itemProps));
+        }
+
+        SFUI::Container sidebar("sidebar", sidebarProps,
+            SFUI::Button("button1", buttonProps),
+            SFUI::Button("button2", buttonProps),
+            SFUI::Container("cover", coverProps,
+                SFUI::Container("coverChild", coverChildProps)
+            )
+        );
+        SFUI::UniquePointer<SFUI::Container> body = std::make_unique<SFUI::Container>("body", bodyProps);
+        body->addChild(std::make_unique<SFUI::Container>(std::move(sidebar)));
+        body->addChild(std::move(list));
+
+        SFUI::UniquePointer<SFUI::Container> root = std::make_unique<SFUI::Container>("root", rootProps);
+        root->addChild(std::make_unique<SFUI::Container>(SFUI::Container("header", headerProps, SFUI::Label("headerLabel", headerLabelProps))));
+        root->addChild(std::move(body));
+        ui.setRootComponent(std::move(root));
+    }
+
+    /**
+     * @brief Get the center of a component's hit bounds.
+     *
+     * @param ui UI holding the component.
+     * @param componentID Component ID of the component.
+     *
+     * @return Center of the component, or the origin if it is not in the UI.
+     */
+    inline SFUI::Vector2i getComponentCenter(SFUI::UIRoot& ui, const SFUI::String& componentID) {
+        const SFUI::Component* component = ui.getComponent<SFUI::Component>(componentID);
+        if (!component) return {0, 0};
+        SFUI::FloatRect bounds = component->getHitBounds();
+        return {static_cast<SFUI::Int>(bounds.position.x + bounds.size.x / 2.0f), static_cast<SFUI::Int>(bounds.position.y + bounds.size.y / 2.0f)};
+    }
+
+    /**
+     * @brief Apply the change of a frame to the equivalence UI, after the previous frame was drawn.
+     *
+     * @param ui UI to change.
+     * @param frame Index of the frame about to be drawn.
+     */
+    inline SFUI::Void applyFrameChange(SFUI::UIRoot& ui, SFUI::Size frame) {
+        if (frame == 1) {
+            if (SFUI::Container* item = ui.getComponent<SFUI::Container>("item2")) item->style.fillColor = SFUI::Color(240, 200, 40);
+        }   else if (frame == 2) {
+            ui.handleEvent(SFUI::Event::MouseMoved{getComponentCenter(ui, "button1")});
+        }   else if (frame == 3) {
+            ui.handleEvent(SFUI::Event::MouseWheelScrolled{sf::Mouse::Wheel::Vertical, -1.0f, getComponentCenter(ui, "list")});
+        }   else if (frame == 4) {
+            ui.handleEvent(SFUI::Event::MouseMoved{getComponentCenter(ui, "list")});
+        }   else if (frame == UNCOVERING_FRAME) {
+            if (SFUI::Container* coverChild = ui.getComponent<SFUI::Container>("coverChild")) coverChild->style.fillColor = SFUI::Color(40, 90, 40, 120);
+        }   else if (frame == 7) {
+            if (SFUI::Container* header = ui.getComponent<SFUI::Container>("header")) header->style.fillColor = SFUI::Color(40, 60, 110);
+        }
+    }
+
+    /**
+     * @brief Draw a frame of both copies of the equivalence UI and check they match.
+     *
+     * @param testedUI Copy drawn with the tested mode.
+     * @param referenceUI Copy drawn plainly.
+     * @param testedTexture Render texture the tested copy is drawn on.
+     * @param referenceTexture Render texture the plain copy is drawn on.
+     * @param frame Index of the frame, reported if the frames differ.
+     */
+    inline SFUI::Void checkEquivalentFrame(SFUI::UIRoot& testedUI, SFUI::UIRoot& referenceUI, SFUI::RenderTexture& testedTexture, SFUI::RenderTexture& referenceTexture, SFUI::Size frame) {
+        SFUI::Image testedImage = captureFrame(testedUI, testedTexture);
+        SFUI::Image referenceImage = captureFrame(referenceUI, referenceTexture);
+        SFUI::Size differentPixels = countDifferentPixels(testedImage, referenceImage);
+        if (differentPixels > 0) std::cerr << "Frame " << frame << ": " << differentPixels << " different pixel(s)" << std::endl;
+        SFUI_CHECK(differentPixels == 0);
+    }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file TestUtilities.hpp
+ * @brief Defines the helpers shared by the SFUI test programs.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * This file contains the check macro and the offscreen rendering helpers
+ * used by the test programs. Each test program is a plain executable that
+ * returns a non-zero exit code when a check fails, so it can be registered
+ * with CTest without a test framework.
+ *
+ * The tests draw to RenderTextures, which need an OpenGL context but no
+ * window, so they also run on a software rasterizer such as Mesa llvmpipe.
+ */
+
+
+#pragma once
+#include <SFML-FlexUI.hpp>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+
+
+namespace SFUITest {
+
+    /**
+     * @brief Number of checks failed by the test program.
+     */
+    inline SFUI::Size failedChecks = 0;
+
+    /**
+     * @brief Record a failed check if the condition does not hold.
+     *
+     * @param condition Condition checked.
+     * @param expression Source text of the condition.
+     * @param file Source file of the check.
+     * @param line Source line of the check.
+     */
+    inline SFUI::Void check(SFUI::Bool condition, const SFUI::String& expression, const SFUI::String& file, SFUI::Int line) {
+        if (condition) return;
+        failedChecks++;
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+    }
+
+    /**
+     * @brief Get the exit code of the test program.
+     *
+     * @return EXIT_SUCCESS if every check held, EXIT_FAILURE otherwise.
+     */
+    inline SFUI::Int result() {
+        if (failedChecks == 0) return EXIT_SUCCESS;
+        std::cerr << failedChecks << " check(s) failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /**
+     * @brief Load the font shipped with the examples.
+     *
+     * @return Loaded font, which is empty if the file could not be opened.
+     */
+    inline SFUI::SharedPointer<SFUI::Font> loadFont() {
+        SFUI::SharedPointer<SFUI::Font> font = std::make_shared<SFUI::Font>();
+        if (!font->openFromFile("assets/inconsolata.ttf")) std::cerr << "Could not open assets/inconsolata.ttf" << std::endl;
+        return font;
+    }
+
+    /**
+     * @brief Update the UI and draw it to a cleared render target.
+     *
+     * @param ui UI to update and draw.
+     * @param drawTarget Render target to draw on.
+     */
+    inline SFUI::Void renderFrame(SFUI::UIRoot& ui, SFUI::RenderTarget& drawTarget) {
+        static SFUI::RenderWindow window;
+        ui.update({drawTarget.getSize().x, drawTarget.getSize().y});
+        drawTarget.clear(SFUI::Color::Black);
+        ui.draw(drawTarget, window);
+    }
+
+    /**
+     * @brief Draw a frame of the UI to a render texture and copy it to an image.
+     *
+     * @param ui UI to update and draw.
+     * @param renderTexture Render texture to draw on.
+     *
+     * @return Image of the drawn frame.
+     */
+    inline SFUI::Image captureFrame(SFUI::UIRoot& ui, SFUI::RenderTexture& renderTexture) {
+        renderFrame(ui, renderTexture);
+        renderTexture.display();
+        return renderTexture.getTexture().copyToImage();
+    }
+
+    /**
+     * @brief Count the pixels of two images of the same size that differ by more than a tolerance.
+     *
+     * @param first First image.
+     * @param second Second image.
+     * @param tolerance Largest difference allowed on each color channel.
+     *
+     * @return Number of different pixels, or the pixel count of the larger image if the sizes differ.
+     */
+    inline SFUI::Size countDifferentPixels(const SFUI::Image& first, const SFUI::Image& second, SFUI::UnsignedInt8 tolerance = 2) {
+        if (first.getSize() != second.getSize()) return std::max(first.getSize().x * first.getSize().y, second.getSize().x * second.getSize().y);
+
+        SFUI::Size differentPixels = 0;
+        for (SFUI::UnsignedInt32 y = 0; y < first.getSize().y; y++) {
+            for (SFUI::UnsignedInt32 x = 0; x < first.getSize().x; x++) {
+                SFUI::Color a = first.getPixel({x, y});
+                SFUI::Color b = second.getPixel({x, y});
+                if (std::abs(a.r - b.r) > tolerance || std::abs(a.g - b.g) > tolerance || std::abs(a.b - b.b) > tolerance || std::abs(a.a - b.a) > tolerance) differentPixels++;
+            }
+        }
+        return differentPixels;
+    }
+}
+
+
+/**
+ * @brief Check a condition, reporting the failure without stopping the test program.
+ */
+#define SFUI_CHECK(condition) SFUITest::check(static_cast<SFUI::Bool>(condition), #condition, __FILE__, __LINE__)
@@ -0,0 +1,140 @@
+/**
+ * @file AdaptiveQualityTest.cpp
+ * @brief Checks that adaptive quality lowers the geometry a UI builds as frames go over budget.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * A UI of rounded, shadowed components is recorded headless with a frame
+ * budget no frame can meet. Every level must be reported to the quality
+ * change callback, the lowest level must be kept, and the levels coarsening
+ * arcs and dropping shadows must record fewer vertices than the level before.
+ * The arcs of a shadow ring follow the corner radius, so narrowing shadows is
+ * checked on the area the shadowed components draw over instead. A budget
+ * every frame meets must then restore the quality.
+ */
+
+
+#include "TestUtilities.hpp"
+
+
+// Target Size of the Recorded Frames, and Most Frames Recorded per Level //
+static const SFUI::Vector2u TARGET_SIZE = {320, 240};
+static constexpr SFUI::Size MAX_FRAMES_PER_LEVEL = SFUI::QualityController::MAX_RESTORE_FRAMES * 2;
+
+
+// Build a Text-Free Tree of Rounded Components With Wide Shadows //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.alignDirection = "vertical";
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+    rootProps.layout.padding = 30.0f;
+    rootProps.style.fillColor = SFUI::Color(32, 32, 32);
+
+    SFUI::PropSet::Container cardProps;
+    cardProps.layout.width = "100%";
+    cardProps.layout.height = 60.0f;
+    cardProps.layout.margin = 10.0f;
+    cardProps.style.cornerRadius = 4.0f;
+    cardProps.style.fillColor = SFUI::Color(90, 90, 90);
+    cardProps.style.shadowOffset = SFUI::Vector2f{4.0f, 4.0f};
+    cardProps.style.shadowRadius = 20.0f;
+    cardProps.style.shadowFillColor = SFUI::Color(0, 0, 0, 128);
+
+    SFUI::Container root("root", rootProps,
+        SFUI::Container("card1", cardProps),
+        SFUI::Container("card2", cardProps)
+    );
+    ui.setRootComponent(std::make_unique<SFUI::Container>(std::move(root)));
+}
+
+
+// Record a Frame, Returning the Number of Vertices Drawn //
+static SFUI::Size recordFrame(SFUI::UIRoot& ui) {
+    SFUI::RecordingRenderBackend backend;
+    ui.update(TARGET_SIZE);
+    ui.draw(backend);
+    return backend.getStatistics().vertices;
+}
+
+
+// Get the Area a Component Draws Over //
+static SFUI::Float getDrawnArea(SFUI::UIRoot& ui, const SFUI::String& componentID) {
+    const SFUI::Component* component = ui.getComponent<SFUI::Component>(componentID);
+    SFUI_CHECK(component != nullptr);
+    if (!component) return 0.0f;
+    SFUI::FloatRect drawBounds = component->getDrawBounds();
+    return drawBounds.size.x * drawBounds.size.y;
+}
+
+
+// Geometry Recorded at a Quality Level //
+struct LevelGeometry {
+    SFUI::Size vertices = 0;
+    SFUI::Float cardArea = 0.0f;
+};
+
+
+// Record Frames Until the Quality Level Changes, Returning the Geometry of the First Frame //
+static LevelGeometry recordLevel(SFUI::UIRoot& ui) {
+    SFUI::QualityController::Level level = ui.getQualityLevel();
+    LevelGeometry levelGeometry;
+    levelGeometry.vertices = recordFrame(ui);
+    levelGeometry.cardArea = getDrawnArea(ui, "card1");
+    for (SFUI::Size frame = 1; frame < MAX_FRAMES_PER_LEVEL && ui.getQualityLevel() == level; frame++) recordFrame(ui);
+    return levelGeometry;
+}
+
+
+// Step the UI Down Through Every Level, Then Back Up //
+int main() {
+    SFUI::UIRoot ui;
+    buildUI(ui);
+
+    SFUI::Vector<SFUI::QualityController::Transition> transitions;
+    ui.setOnQualityChange([&](const SFUI::QualityController::Transition& transition) { transitions.push_back(transition); });
+    ui.setAdaptiveQuality(true);
+    ui.setFrameBudget(SFUI::Time::Zero);
+
+    LevelGeometry full = recordLevel(ui);
+    LevelGeometry composited = recordLevel(ui);
+    LevelGeometry coarseArcs = recordLevel(ui);
+    LevelGeometry reducedShadows = recordLevel(ui);
+    LevelGeometry noShadows = recordLevel(ui);
+
+    // Every Level Is Reported, One Step at a Time //
+    SFUI_CHECK(transitions.size() == 4);
+    for (SFUI::Size i = 0; i < transitions.size(); i++) {
+        SFUI_CHECK(transitions[i].previousLevel == static_cast<SFUI::QualityController::Level>(i));
+        SFUI_CHECK(transitions[i].level == static_cast<SFUI::QualityController::Level>(i + 1));
+        SFUI_CHECK(transitions[i].averageFrameTime > transitions[i].budget);
+    }
+    SFUI_CHECK(ui.getQualityLevel() == SFUI::QualityController::Level::NoShadows);
+
+    // Compositing Keeps the Geometry, the Later Levels Coarsen Arcs, Then Narrow and Drop Shadows //
+    SFUI_CHECK(composited.vertices == full.vertices);
+    SFUI_CHECK(composited.cardArea == full.cardArea);
+    SFUI_CHECK(coarseArcs.vertices < composited.vertices);
+    SFUI_CHECK(coarseArcs.cardArea == composited.cardArea);
+    SFUI_CHECK(reducedShadows.vertices == coarseArcs.vertices);
+    SFUI_CHECK(reducedShadows.cardArea < coarseArcs.cardArea);
+    SFUI_CHECK(noShadows.vertices < reducedShadows.vertices);
+    SFUI_CHECK(noShadows.cardArea < reducedShadows.cardArea);
+
+    // Frames Within Budget Restore the Quality and Its Geometry //
+    transitions.clear();
+    ui.setFrameBudget(sf::seconds(10.0f));
+    recordLevel(ui);
+    SFUI_CHECK(transitions.size() == 1);
+    SFUI_CHECK(ui.getQualityLevel() == SFUI::QualityController::Level::ReducedShadows);
+    SFUI_CHECK(recordFrame(ui) == reducedShadows.vertices);
+    SFUI_CHECK(getDrawnArea(ui, "card1") == reducedShadows.cardArea);
+
+    // Disabling Adaptive Quality Goes Back to Full Quality //
+    ui.setAdaptiveQuality(false);
+    SFUI_CHECK(ui.getQualityLevel() == SFUI::QualityController::Level::Full);
+    SFUI_CHECK(recordFrame(ui) == full.vertices);
+    SFUI_CHECK(getDrawnArea(ui, "card1") == full.cardArea);
+    return SFUITest::result();
+}
@@ -0,0 +1,102 @@
+/**
+ * @file AllocationTest.cpp
+ * @brief Checks that updating and drawing a large UI makes no heap allocation in steady state.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * A tree of about 10k components is warmed up, then updated and drawn for
+ * more frames, unchanged and with a component changing color every frame.
+ * Every allocation of the program is counted, and none may happen during
+ * those frames, whether drawing headless or into a RenderTexture.
+ */
+
+
+#include "AllocationCounter.hpp"
+
+
+// Tree Shape and Frame Counts //
+static constexpr SFUI::Size ROW_COUNT = 100;
+static constexpr SFUI::Size CELLS_PER_ROW = 99;
+static constexpr SFUI::Size WARM_UP_FRAMES = 4;
+static constexpr SFUI::Size MEASURED_FRAMES = 16;
+static const SFUI::Vector2u TARGET_SIZE = {800, 600};
+static const SFUI::Color FIRST_COLOR = SFUI::Color(200, 80, 80);
+static const SFUI::Color SECOND_COLOR = SFUI::Color(80, 80, 200);
+
+
+// Build Rows of Cells Alternating Between Two Colors, so Both Meshes Stay Shared //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.alignDirection = "vertical";
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+    rootProps.style.fillColor = SFUI::Color(32, 32, 32);
+    SFUI::UniquePointer<SFUI::Container> root = std::make_unique<SFUI::Container>("root", rootProps);
+
+    SFUI::PropSet::Container rowProps;
+    rowProps.layout.alignDirection = "horizontal";
+    rowProps.layout.width = "100%";
+    rowProps.layout.height = "1%";
+
+    SFUI::PropSet::Container cellProps;
+    cellProps.layout.width = "1%";
+    cellProps.layout.height = "100%";
+    cellProps.style.cornerRadius = 2.0f;
+
+    for (SFUI::Size row = 0; row < ROW_COUNT; row++) {
+        SFUI::UniquePointer<SFUI::Container> rowContainer = std::make_unique<SFUI::Container>("row" + std::to_string(row), rowProps);
+        for (SFUI::Size cell = 0; cell < CELLS_PER_ROW; cell++) {
+            cellProps.style.fillColor = (row + cell) % 2 == 0 ? FIRST_COLOR : SECOND_COLOR;
+            rowContainer->addChild(std::make_unique<SFUI::Container>("cell" + std::to_string(row) + "_" + std::to_string(cell), cellProps));
+        }
+        root->addChild(std::move(rowContainer));
+    }
+    ui.setRootComponent(std::move(root));
+}
+
+
+// Count the Allocations of Frames Drawn by a Draw Function, After Warming Up //
+template<typename DrawFunction>
+static SFUI::Size countFrameAllocations(SFUI::UIRoot& ui, SFUI::Container* changedCell, DrawFunction draw) {
+    SFUI::Size allocations = 0;
+    for (SFUI::Size frame = 0; frame < WARM_UP_FRAMES + MEASURED_FRAMES; frame++) {
+        // Odd Measured Frames Are Unchanged, Even Ones Recolor a Cell //
+        if (frame % 2 == 0) changedCell->style.fillColor = (frame / 2) % 2 == 0 ? SECOND_COLOR : FIRST_COLOR;
+
+        SFUI::Size allocationsBefore = SFUITest::allocationCount;
+        ui.update(TARGET_SIZE);
+        draw();
+        if (frame >= WARM_UP_FRAMES) allocations += SFUITest::allocationCount - allocationsBefore;
+    }
+    return allocations;
+}
+
+
+// Measure the Headless Path, Then the RenderTexture Path //
+int main() {
+    SFUI::UIRoot ui;
+    buildUI(ui);
+    SFUI::Container* changedCell = ui.getComponent<SFUI::Container>("cell50_50");
+    SFUI_CHECK(changedCell != nullptr);
+    if (!changedCell) return SFUITest::result();
+
+    SFUI::RecordingRenderBackend backend;
+    SFUI::Size recordedAllocations = countFrameAllocations(ui, changedCell, [&]() {
+        backend.reset();
+        ui.draw(backend);
+    });
+    std::cout << "Recorded frames: " << recordedAllocations << " allocation(s)" << std::endl;
+    SFUI_CHECK(recordedAllocations == 0);
+
+    SFUI::RenderTexture renderTexture({TARGET_SIZE.x, TARGET_SIZE.y});
+    SFUI::RenderWindow window;
+    SFUI::Size drawnAllocations = countFrameAllocations(ui, changedCell, [&]() {
+        renderTexture.clear();
+        ui.draw(renderTexture, window);
+        renderTexture.display();
+    });
+    std::cout << "Drawn frames: " << drawnAllocations << " allocation(s)" << std::endl;
+    SFUI_CHECK(drawnAllocations == 0);
+    return SFUITest::result();
+}
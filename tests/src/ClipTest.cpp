@@ -0,0 +1,121 @@
+/**
+ * @file ClipTest.cpp
+ * @brief Checks that children are clipped to their parent when drawing offscreen.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * A child larger than its parent is drawn into a RenderTexture, and the
+ * pixels outside of the parent's content box must stay clear. The clip is
+ * checked again after switching render targets and views, since both make
+ * SFML reapply its view state, including the scissor test. A label drawn
+ * directly, outside of a UI, must give back the scissor it was drawn in.
+ */
+
+
+#include "TestUtilities.hpp"
+
+
+// Clear Color, Parent Content Box and Child Color //
+static const SFUI::Color CLEAR_COLOR = SFUI::Color::Black;
+static const SFUI::Color CHILD_COLOR = SFUI::Color(0, 200, 0);
+static constexpr SFUI::Float PADDING = 50.0f;
+static constexpr SFUI::UnsignedInt32 TARGET_SIZE = 200;
+
+
+// Build a Parent Whose Content Box Is Smaller Than Its Only Child //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container parentProps;
+    parentProps.layout.alignDirection = "vertical";
+    parentProps.layout.alignPrimary = "start";
+    parentProps.layout.alignSecondary = "start";
+    parentProps.layout.width = "100%";
+    parentProps.layout.height = "100%";
+    parentProps.layout.padding = PADDING;
+
+    SFUI::PropSet::Container childProps;
+    childProps.layout.width = 3.0f * TARGET_SIZE;
+    childProps.layout.height = 3.0f * TARGET_SIZE;
+    childProps.style.fillColor = CHILD_COLOR;
+
+    SFUI::Container parent("parent", parentProps,
+        SFUI::Container("child", childProps)
+    );
+    ui.setRootComponent(std::make_unique<SFUI::Container>(std::move(parent)));
+}
+
+
+// Check the Child Only Covers the Parent Content Box, Given Where the View Puts It //
+static SFUI::Void checkClipped(SFUI::RenderTexture& renderTexture, SFUI::Vector2f viewOffset) {
+    renderTexture.display();
+    SFUI::Image image = renderTexture.getTexture().copyToImage();
+    SFUI::Vector2i contentStart(static_cast<SFUI::Int>(PADDING - viewOffset.x), static_cast<SFUI::Int>(PADDING - viewOffset.y));
+    SFUI::Vector2i contentEnd(static_cast<SFUI::Int>(TARGET_SIZE - PADDING - viewOffset.x), static_cast<SFUI::Int>(TARGET_SIZE - PADDING - viewOffset.y));
+
+    for (SFUI::UnsignedInt32 y = 0; y < TARGET_SIZE; y++) {
+        for (SFUI::UnsignedInt32 x = 0; x < TARGET_SIZE; x++) {
+            // Pixels on the Content Box Edges May Be Partly Covered //
+            SFUI::Int px = static_cast<SFUI::Int>(x);
+            SFUI::Int py = static_cast<SFUI::Int>(y);
+            if (px == contentStart.x || px == contentEnd.x || py == contentStart.y || py == contentEnd.y) continue;
+
+            SFUI::Bool inside = px > contentStart.x && px < contentEnd.x && py > contentStart.y && py < contentEnd.y;
+            SFUI::Color expected = inside ? CHILD_COLOR : CLEAR_COLOR;
+            SFUI::Bool matches = image.getPixel({x, y}) == expected;
+            SFUI_CHECK(matches);
+            if (!matches) return;
+        }
+    }
+}
+
+
+// Draw a Label Directly Within a Scissor, Checking the Scissor Is Kept //
+static SFUI::Void checkDirectDrawKeepsScissor(SFUI::RenderTexture& renderTexture) {
+    SFUI::PropSet::Label labelProps;
+    labelProps.style.text = "Clipped";
+    labelProps.style.font = SFUITest::loadFont();
+    SFUI::Label label("label", labelProps);
+    SFUI::RenderWindow window;
+
+    renderTexture.setView(renderTexture.getDefaultView());
+    SFUI::ClipStack::apply(renderTexture, SFUI::FloatRect({PADDING, PADDING}, {TARGET_SIZE - 2.0f * PADDING, TARGET_SIZE - 2.0f * PADDING}));
+    SFUI::FloatRect scissor = renderTexture.getView().getScissor();
+    label.draw(renderTexture, window);
+    SFUI_CHECK(renderTexture.getView().getScissor() == scissor);
+    SFUI::ClipStack::apply(renderTexture, std::nullopt);
+}
+
+
+// Draw Clipped Frames With and Without Batching, Between Other Targets and Views //
+int main() {
+    SFUI::RenderTexture renderTexture({TARGET_SIZE, TARGET_SIZE});
+    SFUI::RenderTexture otherTexture({TARGET_SIZE, TARGET_SIZE});
+    SFUI::Sprite otherSprite(otherTexture.getTexture());
+
+    for (SFUI::Bool renderBatching : {true, false}) {
+        SFUI::UIRoot ui;
+        buildUI(ui);
+        ui.setRenderBatching(renderBatching);
+
+        // Plain Frame on the Default View //
+        renderTexture.setView(renderTexture.getDefaultView());
+        SFUITest::renderFrame(ui, renderTexture);
+        checkClipped(renderTexture, {0.0f, 0.0f});
+
+        // Frame After Drawing to Another Target, Then Drawing That Target Here //
+        otherTexture.clear(CLEAR_COLOR);
+        otherTexture.display();
+        renderTexture.clear(CLEAR_COLOR);
+        renderTexture.draw(otherSprite);
+        SFUITest::renderFrame(ui, renderTexture);
+        checkClipped(renderTexture, {0.0f, 0.0f});
+
+        // Frame on a Moved View, Which the Clip Must Follow //
+        SFUI::Vector2f viewOffset(-20.0f, -20.0f);
+        renderTexture.setView(SFUI::View(SFUI::FloatRect(viewOffset, {static_cast<SFUI::Float>(TARGET_SIZE), static_cast<SFUI::Float>(TARGET_SIZE)})));
+        SFUITest::renderFrame(ui, renderTexture);
+        checkClipped(renderTexture, viewOffset);
+    }
+    checkDirectDrawKeepsScissor(renderTexture);
+    return SFUITest::result();
+}
@@ -0,0 +1,99 @@
+/**
+ * @file ColorBenchmark.cpp
+ * @brief Measures steady-state frames of a color-heavy UI, which must make no heap allocation.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * A themed UI of buttons and sliders, whose colors are given as hex strings,
+ * is hovered back and forth so every frame switches between the normal and
+ * hovered colors of two widgets. The frame cost is reported, and the events,
+ * updates and headless draws of those frames must not allocate.
+ */
+
+
+#include "AllocationCounter.hpp"
+
+
+// Widget Counts and Frame Counts //
+static constexpr SFUI::Size BUTTON_COUNT = 40;
+static constexpr SFUI::Size SLIDER_COUNT = 40;
+static constexpr SFUI::Size WARM_UP_FRAMES = 8;
+static constexpr SFUI::Size MEASURED_FRAMES = 1000;
+static const SFUI::Vector2u TARGET_SIZE = {800, 2000};
+
+
+// Build Rows of Themed Buttons and Sliders, All Colors Given as Hex Strings //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.alignDirection = "vertical";
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+    rootProps.style.fillColor = "#202020";
+    SFUI::UniquePointer<SFUI::Container> root = std::make_unique<SFUI::Container>("root", rootProps);
+
+    SFUI::PropSet::Button buttonProps;
+    buttonProps.layout.width = "100%";
+    buttonProps.layout.height = 24.0f;
+    buttonProps.style.cornerRadius = 5.0f;
+    buttonProps.style.borderWidth = 1.0f;
+    buttonProps.style.fillColor = "#3B3B3B";
+    buttonProps.style.hoveredFillColor = "#4A4A4A";
+    buttonProps.style.pressedFillColor = "#5A5A5AFF";
+    buttonProps.style.borderColor = "#969696";
+    buttonProps.style.shadowFillColor = "#00000080";
+
+    SFUI::PropSet::Slider sliderProps;
+    sliderProps.layout.width = "100%";
+    sliderProps.layout.height = 24.0f;
+    sliderProps.style.cornerRadius = 5.0f;
+    sliderProps.style.fillColor = "#3C3C3C";
+    sliderProps.style.trackUnprogressedFillColor = "#969696";
+    sliderProps.style.trackUnprogressedHoveredFillColor = "#A0A0A0";
+    sliderProps.style.trackProgressedFillColor = "#EB535596";
+    sliderProps.style.thumbFillColor = "#EB5355";
+    sliderProps.state.value = 5.0f;
+    sliderProps.state.minimumValue = 0.0f;
+    sliderProps.state.maximumValue = 20.0f;
+
+    for (SFUI::Size i = 0; i < BUTTON_COUNT; i++) root->addChild(std::make_unique<SFUI::Button>("button" + std::to_string(i), buttonProps));
+    for (SFUI::Size i = 0; i < SLIDER_COUNT; i++) root->addChild(std::make_unique<SFUI::Slider>("slider" + std::to_string(i), sliderProps));
+    ui.setRootComponent(std::move(root));
+}
+
+
+// Get the Center of a Component's Hit Bounds //
+static SFUI::Vector2i getCenter(const SFUI::Component* component) {
+    SFUI::FloatRect bounds = component->getHitBounds();
+    return {static_cast<SFUI::Int>(bounds.position.x + bounds.size.x / 2.0f), static_cast<SFUI::Int>(bounds.position.y + bounds.size.y / 2.0f)};
+}
+
+
+// Hover a Button and a Slider in Turn, Measuring the Frames After Warming Up //
+int main() {
+    SFUI::UIRoot ui;
+    buildUI(ui);
+    SFUI::RecordingRenderBackend backend;
+    ui.update(TARGET_SIZE);
+    SFUI::Vector2i buttonCenter = getCenter(ui.getComponent<SFUI::Button>("button0"));
+    SFUI::Vector2i sliderCenter = getCenter(ui.getComponent<SFUI::Slider>("slider0"));
+
+    SFUI::Size allocations = 0;
+    SFUI::Time measuredTime;
+    for (SFUI::Size frame = 0; frame < WARM_UP_FRAMES + MEASURED_FRAMES; frame++) {
+        SFUI::Event event = SFUI::Event::MouseMoved{frame % 2 == 0 ? buttonCenter : sliderCenter};
+
+        SFUI::Size allocationsBefore = SFUITest::allocationCount;
+        SFUI::Clock frameClock;
+        ui.handleEvent(event);
+        ui.update(TARGET_SIZE);
+        ui.draw(backend);
+        if (frame < WARM_UP_FRAMES) continue;
+        measuredTime += frameClock.getElapsedTime();
+        allocations += SFUITest::allocationCount - allocationsBefore;
+    }
+
+    std::cout << "Frames: " << MEASURED_FRAMES << ", average frame: " << measuredTime.asMicroseconds() / static_cast<SFUI::Double>(MEASURED_FRAMES) << " us, allocations: " << allocations << std::endl;
+    SFUI_CHECK(allocations == 0);
+    return SFUITest::result();
+}
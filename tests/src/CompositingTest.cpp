@@ -0,0 +1,39 @@
+/**
+ * @file CompositingTest.cpp
+ * @brief Checks that a composited UI draws the same pixels as when drawn directly.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * One copy of the equivalence UI is drawn through its composite texture and
+ * the other directly. Every frame of the two copies must match, and the
+ * composite texture may only be redrawn on a frame that changed something.
+ */
+
+
+#include "EquivalenceUI.hpp"
+
+
+// Draw the Composited and Direct Copies Through Every Frame Change //
+int main() {
+    SFUI::SharedPointer<SFUI::Font> font = SFUITest::loadFont();
+    SFUI::UIRoot compositedUI;
+    SFUI::UIRoot directUI;
+    SFUITest::buildEquivalenceUI(compositedUI, font);
+    SFUITest::buildEquivalenceUI(directUI, font);
+    compositedUI.setCompositing(true);
+
+    SFUI::RenderTexture compositedTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+    SFUI::RenderTexture directTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+
+    for (SFUI::Size frame = 0; frame < SFUITest::EQUIVALENCE_FRAME_COUNT; frame++) {
+        SFUITest::applyFrameChange(compositedUI, frame);
+        SFUITest::applyFrameChange(directUI, frame);
+        SFUITest::checkEquivalentFrame(compositedUI, directUI, compositedTexture, directTexture, frame);
+
+        SFUI_CHECK(compositedUI.getCompositeTexture() != nullptr);
+        SFUI_CHECK(compositedUI.hasCompositeChanged() == (frame != SFUITest::UNCHANGED_FRAME));
+    }
+    SFUI_CHECK(directUI.getCompositeTexture() == nullptr);
+    return SFUITest::result();
+}
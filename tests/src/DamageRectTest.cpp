@@ -0,0 +1,53 @@
+/**
+ * @file DamageRectTest.cpp
+ * @brief Checks that partial redraws of the damaged regions draw the same pixels as full redraws.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * One copy of the equivalence UI is drawn through its composite texture,
+ * which only redraws the regions damaged since the last frame, and the
+ * other is fully redrawn every frame. After the first frame, each change
+ * must only damage part of the UI, the unchanged frame must damage nothing,
+ * and every frame of the two copies must still match. The damage of a frame
+ * is read after it was drawn.
+ */
+
+
+#include "EquivalenceUI.hpp"
+
+
+// Get the Total Area of Damaged Regions //
+static SFUI::Float getDamagedArea(const SFUI::Vector<SFUI::FloatRect>& damageRects) {
+    SFUI::Float damagedArea = 0.0f;
+    for (const SFUI::FloatRect& damageRect : damageRects) damagedArea += damageRect.size.x * damageRect.size.y;
+    return damagedArea;
+}
+
+
+// Draw the Partially and Fully Redrawn Copies Through Every Frame Change //
+int main() {
+    SFUI::SharedPointer<SFUI::Font> font = SFUITest::loadFont();
+    SFUI::UIRoot partialUI;
+    SFUI::UIRoot fullUI;
+    SFUITest::buildEquivalenceUI(partialUI, font);
+    SFUITest::buildEquivalenceUI(fullUI, font);
+    partialUI.setCompositing(true);
+
+    SFUI::RenderTexture partialTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+    SFUI::RenderTexture fullTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+    const SFUI::Float targetArea = static_cast<SFUI::Float>(SFUITest::EQUIVALENCE_TARGET_SIZE.x * SFUITest::EQUIVALENCE_TARGET_SIZE.y);
+
+    for (SFUI::Size frame = 0; frame < SFUITest::EQUIVALENCE_FRAME_COUNT; frame++) {
+        SFUITest::applyFrameChange(partialUI, frame);
+        SFUITest::applyFrameChange(fullUI, frame);
+
+        SFUITest::checkEquivalentFrame(partialUI, fullUI, partialTexture, fullTexture, frame);
+
+        // The Damage Gathered by the Update Is Kept After the Draw //
+        SFUI::Float damagedArea = getDamagedArea(partialUI.getDamageRects());
+        if (frame == SFUITest::UNCHANGED_FRAME) SFUI_CHECK(damagedArea == 0.0f);
+        else if (frame > 0) SFUI_CHECK(damagedArea > 0.0f && damagedArea < targetArea);
+    }
+    return SFUITest::result();
+}
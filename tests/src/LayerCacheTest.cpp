@@ -0,0 +1,41 @@
+/**
+ * @file LayerCacheTest.cpp
+ * @brief Checks that components cached as layers draw the same pixels as when drawn directly.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * The header and sidebar of the equivalence UI are cached as layers in one
+ * copy and drawn directly in the other. Every frame of the two copies must
+ * match, including the frames that change a component inside a layer, and
+ * a layer may only be redrawn on a frame that changed something.
+ */
+
+
+#include "EquivalenceUI.hpp"
+
+
+// Draw the Layered and Direct Copies Through Every Frame Change //
+int main() {
+    SFUI::SharedPointer<SFUI::Font> font = SFUITest::loadFont();
+    SFUI::UIRoot layeredUI;
+    SFUI::UIRoot directUI;
+    SFUITest::buildEquivalenceUI(layeredUI, font, true);
+    SFUITest::buildEquivalenceUI(directUI, font, false);
+
+    SFUI::RenderTexture layeredTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+    SFUI::RenderTexture directTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+
+    for (SFUI::Size frame = 0; frame < SFUITest::EQUIVALENCE_FRAME_COUNT; frame++) {
+        SFUITest::applyFrameChange(layeredUI, frame);
+        SFUITest::applyFrameChange(directUI, frame);
+        SFUITest::checkEquivalentFrame(layeredUI, directUI, layeredTexture, directTexture, frame);
+
+        SFUI::LayerCache::Statistics layerStatistics = layeredUI.getLayerStatistics();
+        SFUI_CHECK(layerStatistics.layerCount == 2);
+        if (frame == 0) SFUI_CHECK(layerStatistics.renderedLayers == 2);
+        if (frame == SFUITest::UNCHANGED_FRAME) SFUI_CHECK(layerStatistics.renderedLayers == 0);
+    }
+    SFUI_CHECK(directUI.getLayerStatistics().layerCount == 0);
+    return SFUITest::result();
+}
@@ -0,0 +1,78 @@
+/**
+ * @file MeshRegistryTest.cpp
+ * @brief Checks the sharing of meshes between the components of a UI.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * Identical components of a UI share one mesh from the registry of their
+ * UIRoot, separate UIs do not share meshes, and geometry inputs that are
+ * not finite are never registered.
+ */
+
+
+#include "TestUtilities.hpp"
+#include <limits>
+
+
+// Target Size of the Updated Frames //
+static const SFUI::Vector2u TARGET_SIZE = {320, 470};
+
+
+// Build a Container of Identical Buttons //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.alignDirection = "vertical";
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+
+    SFUI::PropSet::Button buttonProps;
+    buttonProps.layout.width = "100%";
+    buttonProps.layout.height = 50.0f;
+    buttonProps.style.cornerRadius = 5.0f;
+    buttonProps.style.fillColor = SFUI::Color(50, 50, 50);
+
+    SFUI::Container root("root", rootProps,
+        SFUI::Button("button1", buttonProps),
+        SFUI::Button("button2", buttonProps),
+        SFUI::Button("button3", buttonProps)
+    );
+    ui.setRootComponent(std::make_unique<SFUI::Container>(std::move(root)));
+}
+
+
+// Check Registry Lookups, Then Sharing Within and Across UIs //
+int main() {
+    SFUI::MeshRegistry meshRegistry;
+    SFUI::MeshRegistry::GeometryKey geometryKey = {{10.0f, 10.0f}, {0, 0}, {2.0f, 2.0f, 2.0f, 2.0f}, 0.0f, SFUI::Color::White, SFUI::Color::White, {0.0f, 0.0f}, 1.0f, SFUI::Color::Transparent, 1.0f, true};
+    SFUI::SharedPointer<const SFUI::Mesh> mesh = std::make_shared<SFUI::Mesh>();
+    meshRegistry.insert(geometryKey, mesh);
+    SFUI_CHECK(meshRegistry.find(geometryKey) == mesh);
+    SFUI_CHECK(meshRegistry.getMeshCount() == 1);
+
+    // A NaN Key Is Neither Registered Nor Found //
+    SFUI::MeshRegistry::GeometryKey nanKey = geometryKey;
+    nanKey.size.x = std::numeric_limits<SFUI::Float>::quiet_NaN();
+    meshRegistry.insert(nanKey, std::make_shared<SFUI::Mesh>());
+    SFUI_CHECK(meshRegistry.find(nanKey) == nullptr);
+    SFUI_CHECK(meshRegistry.getMeshCount() == 1);
+
+    // Freed Meshes Are No Longer Found //
+    mesh.reset();
+    SFUI_CHECK(meshRegistry.find(geometryKey) == nullptr);
+    SFUI_CHECK(meshRegistry.getMeshCount() == 0);
+
+    // Each UI Shares Meshes Between Its Own Components Only //
+    SFUI::UIRoot firstUI;
+    SFUI::UIRoot secondUI;
+    buildUI(firstUI);
+    buildUI(secondUI);
+    firstUI.update(TARGET_SIZE);
+    SFUI::Size firstCount = firstUI.getSharedMeshCount();
+    SFUI_CHECK(firstCount > 0);
+    SFUI_CHECK(secondUI.getSharedMeshCount() == 0);
+    secondUI.update(TARGET_SIZE);
+    SFUI_CHECK(secondUI.getSharedMeshCount() == firstCount);
+    SFUI_CHECK(firstUI.getSharedMeshCount() == firstCount);
+    return SFUITest::result();
+}
@@ -0,0 +1,65 @@
+/**
+ * @file OcclusionTest.cpp
+ * @brief Checks that occlusion culling draws the same pixels as drawing every component.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * One copy of the equivalence UI skips the components covered by opaque
+ * components drawn after them, and the other draws every component. The
+ * covered panel must be skipped while its opaque child covers it, and drawn
+ * again once the child turns translucent, and every frame of the two copies
+ * must match. Skipping components must lower the drawn area, both when
+ * drawing to a render texture and when recording headless.
+ */
+
+
+#include "EquivalenceUI.hpp"
+
+
+// Update and Record a Headless Frame, Returning Its Statistics //
+static SFUI::RenderBatch::FrameStatistics recordFrame(SFUI::UIRoot& ui) {
+    SFUI::RecordingRenderBackend backend;
+    ui.update(SFUITest::EQUIVALENCE_TARGET_SIZE);
+    ui.draw(backend);
+    return ui.getFrameStatistics();
+}
+
+
+// Record the Culled and Unculled Copies Headless, Then Draw Them Through Every Frame Change //
+int main() {
+    SFUI::SharedPointer<SFUI::Font> font = SFUITest::loadFont();
+    SFUI::UIRoot culledUI;
+    SFUI::UIRoot unculledUI;
+    SFUITest::buildEquivalenceUI(culledUI, font);
+    SFUITest::buildEquivalenceUI(unculledUI, font);
+    culledUI.setOcclusionCulling(true);
+
+    // The Headless Path Skips the Covered Panel Too, Drawing Less Area //
+    SFUI::RenderBatch::FrameStatistics culledStatistics = recordFrame(culledUI);
+    SFUI::RenderBatch::FrameStatistics unculledStatistics = recordFrame(unculledUI);
+    SFUI_CHECK(culledStatistics.occludedComponents > 0);
+    SFUI_CHECK(unculledStatistics.occludedComponents == 0);
+    SFUI_CHECK(culledStatistics.drawnArea < unculledStatistics.drawnArea);
+
+    SFUI::RenderTexture culledTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+    SFUI::RenderTexture unculledTexture({SFUITest::EQUIVALENCE_TARGET_SIZE.x, SFUITest::EQUIVALENCE_TARGET_SIZE.y});
+
+    SFUI::Size previousOccludedComponents = 0;
+    for (SFUI::Size frame = 0; frame < SFUITest::EQUIVALENCE_FRAME_COUNT; frame++) {
+        SFUITest::applyFrameChange(culledUI, frame);
+        SFUITest::applyFrameChange(unculledUI, frame);
+        SFUITest::checkEquivalentFrame(culledUI, unculledUI, culledTexture, unculledTexture, frame);
+
+        // Uncovering the Panel Must Bring It Back //
+        SFUI::Size occludedComponents = culledUI.getFrameStatistics().occludedComponents;
+        if (frame == 0) {
+            SFUI_CHECK(occludedComponents > 0);
+            SFUI_CHECK(culledUI.getFrameStatistics().drawnArea < unculledUI.getFrameStatistics().drawnArea);
+        }
+        if (frame == SFUITest::UNCOVERING_FRAME) SFUI_CHECK(occludedComponents < previousOccludedComponents);
+        SFUI_CHECK(unculledUI.getFrameStatistics().occludedComponents == 0);
+        previousOccludedComponents = occludedComponents;
+    }
+    return SFUITest::result();
+}
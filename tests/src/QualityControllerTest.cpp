@@ -0,0 +1,85 @@
+/**
+ * @file QualityControllerTest.cpp
+ * @brief Checks the quality levels chosen by the frame budget controller.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * Frames over budget must reduce the quality one level at a time, narrowing
+ * shadows before dropping them, and frames well under budget must restore it.
+ * A level restored too early must double the wait before the next restore,
+ * up to its cap, and a level kept long enough must reset the wait.
+ */
+
+
+#include "TestUtilities.hpp"
+
+
+// Feed Frames of a Cost Until the Level Changes, Returning the New Level //
+static SFUI::QualityController::Level runUntilTransition(SFUI::QualityController& qualityController, SFUI::Time frameCost) {
+    for (SFUI::Size frame = 0; frame < SFUI::QualityController::MAX_RESTORE_FRAMES * 2; frame++) {
+        SFUI::Optional<SFUI::QualityController::Transition> transition = qualityController.addFrame(frameCost);
+        if (transition.has_value()) return transition->level;
+    }
+    return qualityController.getLevel();
+}
+
+
+// Feed Frames of a Cost Until the Level Changes, Returning the Number of Frames Fed //
+static SFUI::Size countUntilTransition(SFUI::QualityController& qualityController, SFUI::Time frameCost) {
+    for (SFUI::Size frame = 0; frame < SFUI::QualityController::MAX_RESTORE_FRAMES * 2; frame++) {
+        if (qualityController.addFrame(frameCost).has_value()) return frame + 1;
+    }
+    return SFUI::QualityController::MAX_RESTORE_FRAMES * 2;
+}
+
+
+// Check a Restore Waited for a Number of Frames With Headroom, Allowing the Smoothed Cost to Settle First //
+static SFUI::Void checkRestoreWait(SFUI::Size fedFrames, SFUI::Size restoreFrames) {
+    static constexpr SFUI::Size SETTLING_FRAMES = 40;
+    if (fedFrames < restoreFrames || fedFrames > restoreFrames + SETTLING_FRAMES) std::cerr << "Restored after " << fedFrames << " frame(s), expected " << restoreFrames << std::endl;
+    SFUI_CHECK(fedFrames >= restoreFrames && fedFrames <= restoreFrames + SETTLING_FRAMES);
+}
+
+
+// Step Down Through Every Level, Then Back Up //
+int main() {
+    SFUI::QualityController qualityController;
+    SFUI::Time overBudget = SFUI::QualityController::DEFAULT_BUDGET * 2.0f;
+    SFUI::Time underBudget = SFUI::QualityController::DEFAULT_BUDGET * 0.25f;
+
+    SFUI_CHECK(qualityController.getLevel() == SFUI::QualityController::Level::Full);
+    SFUI_CHECK(runUntilTransition(qualityController, overBudget) == SFUI::QualityController::Level::Composited);
+    SFUI_CHECK(runUntilTransition(qualityController, overBudget) == SFUI::QualityController::Level::CoarseArcs);
+    SFUI_CHECK(runUntilTransition(qualityController, overBudget) == SFUI::QualityController::Level::ReducedShadows);
+    SFUI_CHECK(runUntilTransition(qualityController, overBudget) == SFUI::QualityController::Level::NoShadows);
+
+    // The Lowest Level Is Kept While Frames Stay Over Budget //
+    SFUI_CHECK(runUntilTransition(qualityController, overBudget) == SFUI::QualityController::Level::NoShadows);
+
+    SFUI_CHECK(runUntilTransition(qualityController, underBudget) == SFUI::QualityController::Level::ReducedShadows);
+    SFUI_CHECK(runUntilTransition(qualityController, underBudget) == SFUI::QualityController::Level::CoarseArcs);
+
+    qualityController.reset();
+    SFUI_CHECK(qualityController.getLevel() == SFUI::QualityController::Level::Full);
+
+    // Each Restore Reduced Again Right Away Doubles the Wait Before the Next One, Up to the Cap //
+    SFUI::Size restoreFrames = SFUI::QualityController::RESTORE_FRAMES;
+    countUntilTransition(qualityController, overBudget);
+    for (SFUI::Size restore = 0; restore < 6; restore++) {
+        checkRestoreWait(countUntilTransition(qualityController, underBudget), restoreFrames);
+        SFUI_CHECK(qualityController.getLevel() == SFUI::QualityController::Level::Full);
+        countUntilTransition(qualityController, overBudget);
+        SFUI_CHECK(qualityController.getLevel() == SFUI::QualityController::Level::Composited);
+        restoreFrames = std::min(2 * restoreFrames, SFUI::QualityController::MAX_RESTORE_FRAMES);
+    }
+    SFUI_CHECK(restoreFrames == SFUI::QualityController::MAX_RESTORE_FRAMES);
+
+    // A Restored Level Kept Longer Than the Wait Resets It //
+    checkRestoreWait(countUntilTransition(qualityController, underBudget), SFUI::QualityController::MAX_RESTORE_FRAMES);
+    SFUI::Time withinBudget = SFUI::QualityController::DEFAULT_BUDGET * 0.8f;
+    SFUI_CHECK(countUntilTransition(qualityController, withinBudget) == SFUI::QualityController::MAX_RESTORE_FRAMES * 2);
+    countUntilTransition(qualityController, overBudget);
+    checkRestoreWait(countUntilTransition(qualityController, underBudget), SFUI::QualityController::RESTORE_FRAMES);
+    return SFUITest::result();
+}
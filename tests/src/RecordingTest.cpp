@@ -0,0 +1,105 @@
+/**
+ * @file RecordingTest.cpp
+ * @brief Checks that a UI tree without texts is recorded without an OpenGL context.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * The tree is updated and drawn to a RecordingRenderBackend only. The test
+ * is run without a display, so any OpenGL resource created while updating
+ * or recording makes it fail. Texts are left out, since laying them out
+ * already needs an OpenGL context.
+ */
+
+
+#include "TestUtilities.hpp"
+
+
+// Target Size of the Recorded Frames //
+static const SFUI::Vector2u TARGET_SIZE = {320, 470};
+
+
+// Build a Text-Free Tree of Styled Components, With a Scrolled Clip //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.alignDirection = "vertical";
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+    rootProps.layout.padding = 5.0f;
+    rootProps.style.fillColor = SFUI::Color(32, 32, 32);
+
+    SFUI::PropSet::ScrollContainer scrollProps;
+    scrollProps.layout.alignDirection = "vertical";
+    scrollProps.layout.width = "100%";
+    scrollProps.layout.height = "50%";
+
+    SFUI::PropSet::Button buttonProps;
+    buttonProps.layout.width = "100%";
+    buttonProps.layout.height = 70.0f;
+    buttonProps.style.cornerRadius = 5.0f;
+    buttonProps.style.fillColor = SFUI::Color(50, 50, 50);
+
+    SFUI::PropSet::Toggle toggleProps;
+    toggleProps.layout.width = "50%";
+    toggleProps.layout.height = 70.0f;
+    toggleProps.style.cornerRadius = 5.0f;
+    toggleProps.style.offFillColor = SFUI::Color(150, 150, 150);
+
+    SFUI::PropSet::Slider sliderProps;
+    sliderProps.layout.width = "100%";
+    sliderProps.layout.height = 40.0f;
+    sliderProps.style.cornerRadius = 5.0f;
+    sliderProps.style.thumbFillColor = SFUI::Color(235, 83, 85);
+
+    SFUI::Container root("root", rootProps,
+        SFUI::Slider("slider", sliderProps),
+        SFUI::ScrollContainer("scroll", scrollProps,
+            SFUI::Button("button1", buttonProps),
+            SFUI::Toggle("toggle", toggleProps),
+            SFUI::Button("button2", buttonProps),
+            SFUI::Button("button3", buttonProps),
+            SFUI::Button("button4", buttonProps)
+        )
+    );
+    ui.setRootComponent(std::make_unique<SFUI::Container>(std::move(root)));
+}
+
+
+// Record a Frame, Returning What the Backend Counted //
+static SFUI::RecordingRenderBackend::Statistics recordFrame(SFUI::UIRoot& ui, SFUI::RecordingRenderBackend& backend) {
+    backend.reset();
+    ui.update(TARGET_SIZE);
+    ui.draw(backend);
+    return backend.getStatistics();
+}
+
+
+// Record Frames Before and After a Change, Checking Each Is Complete and Repeatable //
+int main() {
+    SFUI::UIRoot ui;
+    buildUI(ui);
+    SFUI::RecordingRenderBackend backend;
+
+    SFUI::RecordingRenderBackend::Statistics first = recordFrame(ui, backend);
+    SFUI_CHECK(first.replays > 0);
+    SFUI_CHECK(first.drawCalls > 0);
+    SFUI_CHECK(first.vertices > 0);
+    SFUI_CHECK(ui.getFrameStatistics().issuedDrawCalls > 0);
+
+    // An Unchanged Tree Records the Same Frame //
+    SFUI::RecordingRenderBackend::Statistics second = recordFrame(ui, backend);
+    SFUI_CHECK(second.drawCalls == first.drawCalls);
+    SFUI_CHECK(second.vertices == first.vertices);
+
+    // A Changed Tree Is Recorded Again, With and Without Batching //
+    ui.getComponent<SFUI::Button>("button1")->style.cornerRadius = 20.0f;
+    SFUI::RecordingRenderBackend::Statistics changed = recordFrame(ui, backend);
+    SFUI_CHECK(changed.drawCalls > 0);
+    SFUI_CHECK(changed.vertices > 0);
+
+    ui.setRenderBatching(false);
+    SFUI::RecordingRenderBackend::Statistics unbatched = recordFrame(ui, backend);
+    SFUI_CHECK(unbatched.drawCalls >= changed.drawCalls);
+    SFUI_CHECK(unbatched.vertices == changed.vertices);
+    return SFUITest::result();
+}
@@ -0,0 +1,89 @@
+/**
+ * @file ShadowBenchmark.cpp
+ * @brief Compares the frame statistics of the demo UI drawn with ring shadows and with stacked shadow layers.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * The demo UI of the examples is given wide shadows on its container, text
+ * field and buttons, and is drawn without shadows, with ring shadows and
+ * with stacked shadow layers. Retained geometry is turned off, so every
+ * frame uploads its whole geometry and the uploaded vertices measure the
+ * geometry drawn.
+ */
+
+
+#include "TestUtilities.hpp"
+#include "ui.hpp"
+
+
+// Shadow Style, Frame Counts and Target Size of the Demo //
+static constexpr SFUI::Float SHADOW_RADIUS = 20.0f;
+static const SFUI::Vector2f SHADOW_OFFSET = {4.0f, 4.0f};
+static const SFUI::Color SHADOW_COLOR = SFUI::Color(0, 0, 0, 128);
+static constexpr SFUI::Size WARM_UP_FRAMES = 8;
+static constexpr SFUI::Size MEASURED_FRAMES = 200;
+static const SFUI::Vector2u TARGET_SIZE = {320, 470};
+
+
+// Set the Shadow Style of a Component of the Demo //
+template<typename T>
+static SFUI::Void setShadow(SFUI::UIRoot& ui, const SFUI::String& componentID) {
+    T* component = ui.getComponent<T>(componentID);
+    SFUI_CHECK(component != nullptr);
+    if (!component) return;
+    component->style.shadowOffset = SHADOW_OFFSET;
+    component->style.shadowRadius = SHADOW_RADIUS;
+    component->style.shadowFillColor = SHADOW_COLOR;
+}
+
+
+// Give Every Shadowed Component Its Shadow //
+static SFUI::Void setShadows(SFUI::UIRoot& ui) {
+    setShadow<SFUI::Container>(ui, "midContainer");
+    setShadow<SFUI::TextField>(ui, "textField");
+    setShadow<SFUI::Button>(ui, "scrollButton1");
+    setShadow<SFUI::Button>(ui, "scrollButton2");
+    setShadow<SFUI::Button>(ui, "scrollButton3");
+    setShadow<SFUI::Button>(ui, "scrollButton4");
+}
+
+
+// Draw Frames of the Demo, Returning the Statistics of the Last One and Printing the Average Frame Time //
+static SFUI::RenderBatch::FrameStatistics measureFrames(SFUI::UIRoot& ui, SFUI::RenderTexture& renderTexture, const SFUI::String& name) {
+    SFUI::Time measuredTime;
+    for (SFUI::Size frame = 0; frame < WARM_UP_FRAMES + MEASURED_FRAMES; frame++) {
+        SFUI::Clock frameClock;
+        SFUITest::renderFrame(ui, renderTexture);
+        renderTexture.display();
+        if (frame >= WARM_UP_FRAMES) measuredTime += frameClock.getElapsedTime();
+    }
+
+    SFUI::RenderBatch::FrameStatistics frameStatistics = ui.getFrameStatistics();
+    std::cout << name << ": " << frameStatistics.issuedDrawCalls << " draw call(s), " << frameStatistics.uploadedVertices << " uploaded vertices, average frame: " << measuredTime.asMicroseconds() / static_cast<SFUI::Double>(MEASURED_FRAMES) << " us" << std::endl;
+    return frameStatistics;
+}
+
+
+// Measure the Demo Without Shadows, Then With Ring Shadows, Then With Stacked Shadow Layers //
+int main() {
+    SFUI::SharedPointer<SFUI::Font> font = SFUITest::loadFont();
+    SFUI::SharedPointer<SFUI::Texture> texture = std::make_shared<SFUI::Texture>();
+    if (!texture->loadFromFile("assets/image.png")) std::cerr << "Could not open assets/image.png" << std::endl;
+
+    SFUI::UIRoot ui;
+    buildUI(ui, font, texture);
+    ui.setRetainedGeometry(false);
+    SFUI::RenderTexture renderTexture({TARGET_SIZE.x, TARGET_SIZE.y});
+
+    SFUI::RenderBatch::FrameStatistics noShadowStatistics = measureFrames(ui, renderTexture, "No shadows");
+    setShadows(ui);
+    SFUI::RenderBatch::FrameStatistics ringStatistics = measureFrames(ui, renderTexture, "Ring shadows");
+    ui.setShadowRings(false);
+    SFUI::RenderBatch::FrameStatistics layerStatistics = measureFrames(ui, renderTexture, "Stacked shadow layers");
+
+    // Shadows Add Vertices, the Ring Fewer Than the Layers //
+    SFUI_CHECK(ringStatistics.uploadedVertices > noShadowStatistics.uploadedVertices);
+    SFUI_CHECK(ringStatistics.uploadedVertices < layerStatistics.uploadedVertices);
+    return SFUITest::result();
+}
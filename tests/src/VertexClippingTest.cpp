@@ -0,0 +1,123 @@
+/**
+ * @file VertexClippingTest.cpp
+ * @brief Checks that vertex clipping draws the same pixels as scissor clipping.
+ * @author Connor Sempf
+ * @date 2025-12-04
+ * @version 2.0.2
+ *
+ * Two copies of a UI with a scroll container nested in another are drawn
+ * into RenderTextures, one with vertex clipping and one with the scissor
+ * clip, and both are scrolled the same way between frames. Rounded and
+ * bordered items cross the edges of both scroll containers, and every frame
+ * of the two copies must match pixel for pixel. The layout only uses whole
+ * pixel sizes, so the clip edges fall between pixels in both modes.
+ */
+
+
+#include "TestUtilities.hpp"
+
+
+// Target Size, Scroll Positions and Colors //
+static const SFUI::Vector2u TARGET_SIZE = {240, 320};
+static const SFUI::Vector2i OUTER_SCROLL_POSITION = {120, 30};
+static const SFUI::Vector2i INNER_SCROLL_POSITION = {120, 150};
+static const SFUI::Color ITEM_COLOR = SFUI::Color(200, 90, 60);
+static const SFUI::Color INNER_ITEM_COLOR = SFUI::Color(60, 140, 210);
+static const SFUI::Color BORDER_COLOR = SFUI::Color(240, 240, 240);
+
+
+// Build a Scroll Container Holding Items and a Second, Nested Scroll Container //
+static SFUI::Void buildUI(SFUI::UIRoot& ui) {
+    SFUI::PropSet::Container rootProps;
+    rootProps.layout.width = "100%";
+    rootProps.layout.height = "100%";
+    rootProps.layout.padding = 10.0f;
+    rootProps.style.fillColor = SFUI::Color(32, 32, 32);
+
+    SFUI::PropSet::ScrollContainer outerProps;
+    outerProps.layout.alignDirection = "vertical";
+    outerProps.layout.alignPrimary = "start";
+    outerProps.layout.alignSecondary = "center";
+    outerProps.layout.width = "100%";
+    outerProps.layout.height = "100%";
+    outerProps.layout.padding = 10.0f;
+    outerProps.style.fillColor = SFUI::Color(70, 70, 70);
+
+    SFUI::PropSet::ScrollContainer innerProps = outerProps;
+    innerProps.layout.height = 120.0f;
+    innerProps.layout.padding = 6.0f;
+    innerProps.style.cornerRadius = 8.0f;
+    innerProps.style.fillColor = SFUI::Color(50, 50, 50);
+
+    SFUI::PropSet::Container itemProps;
+    itemProps.layout.width = "100%";
+    itemProps.layout.height = 80.0f;
+    itemProps.style.cornerRadius = 12.0f;
+    itemProps.style.borderWidth = 3.0f;
+    itemProps.style.fillColor = ITEM_COLOR;
+    itemProps.style.borderColor = BORDER_COLOR;
+
+    SFUI::PropSet::Container innerItemProps = itemProps;
+    innerItemProps.layout.height = 50.0f;
+    innerItemProps.style.cornerRadius = 10.0f;
+    innerItemProps.style.borderWidth = 2.0f;
+    innerItemProps.style.fillColor = INNER_ITEM_COLOR;
+
+    SFUI::Container root("root", rootProps,
+        SFUI::ScrollContainer("outerScroll", outerProps,
+            SFUI::Container("item1", itemProps),
+            SFUI::ScrollContainer("innerScroll", innerProps,
+                SFUI::Container("innerItem1", innerItemProps),
+                SFUI::Container("innerItem2", innerItemProps),
+                SFUI::Container("innerItem3", innerItemProps),
+                SFUI::Container("innerItem4", innerItemProps),
+                SFUI::Container("innerItem5", innerItemProps)
+            ),
+            SFUI::Container("item2", itemProps),
+            SFUI::Container("item3", itemProps)
+        )
+    );
+    ui.setRootComponent(std::make_unique<SFUI::Container>(std::move(root)));
+}
+
+
+// Scroll Whatever Is Under a Position, One Wheel Step Down //
+static SFUI::Void scroll(SFUI::UIRoot& ui, SFUI::Vector2i position) {
+    ui.handleEvent(SFUI::Event::MouseWheelScrolled{sf::Mouse::Wheel::Vertical, -1.0f, position});
+}
+
+
+// Scroll Both Copies Alike, Comparing Every Frame //
+int main() {
+    SFUI::UIRoot vertexClippedUI;
+    SFUI::UIRoot scissorClippedUI;
+    buildUI(vertexClippedUI);
+    buildUI(scissorClippedUI);
+    vertexClippedUI.setVertexClipping(true);
+    scissorClippedUI.setVertexClipping(false);
+
+    SFUI::RenderTexture vertexClippedTexture({TARGET_SIZE.x, TARGET_SIZE.y});
+    SFUI::RenderTexture scissorClippedTexture({TARGET_SIZE.x, TARGET_SIZE.y});
+
+    // Unscrolled, Then Scrolling the Inner, Outer, Inner and Outer Containers in Turn //
+    const SFUI::Vector<SFUI::Optional<SFUI::Vector2i>> scrollPositions = {
+        std::nullopt,
+        INNER_SCROLL_POSITION,
+        OUTER_SCROLL_POSITION,
+        INNER_SCROLL_POSITION,
+        OUTER_SCROLL_POSITION,
+        OUTER_SCROLL_POSITION
+    };
+    for (const SFUI::Optional<SFUI::Vector2i>& scrollPosition : scrollPositions) {
+        if (scrollPosition.has_value()) {
+            scroll(vertexClippedUI, scrollPosition.value());
+            scroll(scissorClippedUI, scrollPosition.value());
+        }
+        SFUI::Image vertexClippedImage = SFUITest::captureFrame(vertexClippedUI, vertexClippedTexture);
+        SFUI::Image scissorClippedImage = SFUITest::captureFrame(scissorClippedUI, scissorClippedTexture);
+        SFUI::Size differentPixels = SFUITest::countDifferentPixels(vertexClippedImage, scissorClippedImage);
+        if (differentPixels > 0) std::cerr << differentPixels << " different pixel(s)" << std::endl;
+        SFUI_CHECK(differentPixels == 0);
+    }
+    return SFUITest::result();
+}